@@ -30,10 +30,17 @@ $(TEST_OUTPUT)_SRC := \
 	tests/test_common/test_fixture.cpp \
 	tests/test_common/test_keymap_key.cpp \
 	tests/test_common/test_logger.cpp \
+	tests/test_common/trace_replay.cpp \
 	$(patsubst $(ROOTDIR)/%,%,$(wildcard $(TEST_PATH)/*.cpp))
 
 $(TEST_OUTPUT)_DEFS := $(OPT_DEFS) "-DKEYMAP_C=\"keymap.c\""
 
+ifeq ($(strip $(BENCH)), yes)
+$(TEST_OUTPUT)_SRC += tests/test_common/bench.cpp
+# Build the benchmarks at the optimisation level of the firmware, after -Og
+$(TEST_OUTPUT)_DEFS += -Os -DBENCH_SUITE=\"$(TEST)\"
+endif
+
 $(TEST_OUTPUT)_CONFIG := $(TEST_PATH)/config.h
 
 VPATH += $(TOP_DIR)/tests/test_common
@@ -39,9 +39,11 @@ GENERIC_FEATURES = \
     LAYER_LOCK \
     LEADER \
     MAGIC \
+    MATRIX_TRACE \
     MOUSEKEY \
     MUSIC \
     OS_DETECTION \
+    PROFILING \
     PROGRAMMABLE_BUTTON \
     REPEAT_KEY \
     SECURE \
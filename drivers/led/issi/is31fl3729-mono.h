@@ -75,6 +75,7 @@ void is31fl3729_update_pwm_buffers(uint8_t index);
 void is31fl3729_update_scaling_registers(uint8_t index);
 
 void is31fl3729_flush(void);
+bool is31fl3729_flush_step(void);
 
 #define IS31FL3729_SW_PULLDOWN_0_OHM 0b000
 #define IS31FL3729_SW_PULLDOWN_0K5_OHM_SW_OFF 0b001
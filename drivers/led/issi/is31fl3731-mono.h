@@ -122,6 +122,7 @@ void is31fl3731_update_pwm_buffers(uint8_t index);
 void is31fl3731_update_led_control_registers(uint8_t index);
 
 void is31fl3731_flush(void);
+bool is31fl3731_flush_step(void);
 
 #define C1_1 0x00
 #define C1_2 0x01
@@ -17,11 +17,14 @@
  */
 
 #include "is31fl3731.h"
+#include "is31fl37xx_common.h"
 #include "i2c_master.h"
 #include "gpio.h"
 #include "wait.h"
 
 #define IS31FL3731_PWM_REGISTER_COUNT 144
+#define IS31FL3731_PWM_CHUNK_SIZE 16
+#define IS31FL3731_PWM_CHUNK_BIT(reg) (1 << ((reg) / IS31FL3731_PWM_CHUNK_SIZE))
 #define IS31FL3731_LED_CONTROL_REGISTER_COUNT 18
 
 #ifndef IS31FL3731_I2C_TIMEOUT
@@ -51,47 +54,42 @@ const uint8_t i2c_addresses[IS31FL3731_DRIVER_COUNT] = {
 // buffers and the transfers in is31fl3731_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
 typedef struct is31fl3731_driver_t {
-    uint8_t pwm_buffer[IS31FL3731_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
-    uint8_t led_control_buffer[IS31FL3731_LED_CONTROL_REGISTER_COUNT];
-    bool    led_control_buffer_dirty;
+    uint8_t  pwm_buffer[IS31FL3731_PWM_REGISTER_COUNT];
+    uint16_t pwm_buffer_dirty;
+    uint8_t  led_control_buffer[IS31FL3731_LED_CONTROL_REGISTER_COUNT];
+    bool     led_control_buffer_dirty;
 } PACKED is31fl3731_driver_t;
 
 is31fl3731_driver_t driver_buffers[IS31FL3731_DRIVER_COUNT] = {{
     .pwm_buffer               = {0},
-    .pwm_buffer_dirty         = false,
+    .pwm_buffer_dirty         = 0,
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
 }};
 
+static const is31fl37xx_chip_t is31fl3731_chip = {
+    .timeout        = IS31FL3731_I2C_TIMEOUT,
+    .persistence    = IS31FL3731_I2C_PERSISTENCE,
+    .write_lock     = false,
+    .pwm_page_count = 1,
+    .pwm_pages      = {{
+        .command        = IS31FL37XX_PAGE_NONE,
+        .first_register = IS31FL3731_FRAME_REG_PWM,
+        .register_count = IS31FL3731_PWM_REGISTER_COUNT,
+        .chunk_size     = IS31FL3731_PWM_CHUNK_SIZE,
+    }},
+};
+
 void is31fl3731_write_register(uint8_t index, uint8_t reg, uint8_t data) {
-#if IS31FL3731_I2C_PERSISTENCE > 0
-    for (uint8_t i = 0; i < IS31FL3731_I2C_PERSISTENCE; i++) {
-        if (i2c_write_register(i2c_addresses[index] << 1, reg, &data, 1, IS31FL3731_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-    }
-#else
-    i2c_write_register(i2c_addresses[index] << 1, reg, &data, 1, IS31FL3731_I2C_TIMEOUT);
-#endif
+    is31fl37xx_write_register(&is31fl3731_chip, i2c_addresses[index], reg, data);
 }
 
 void is31fl3731_select_page(uint8_t index, uint8_t page) {
-    is31fl3731_write_register(index, IS31FL3731_REG_COMMAND, page);
+    is31fl37xx_select_page(&is31fl3731_chip, i2c_addresses[index], page);
 }
 
 void is31fl3731_write_pwm_buffer(uint8_t index) {
-    // Assumes page 0 is already selected.
-    // Transmit PWM registers in 9 transfers of 16 bytes.
-
-    // Iterate over the pwm_buffer contents at 16 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3731_PWM_REGISTER_COUNT; i += 16) {
-#if IS31FL3731_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3731_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3731_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
-#else
-        i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3731_I2C_TIMEOUT);
-#endif
-    }
+    is31fl37xx_write_pwm_buffer(&is31fl3731_chip, i2c_addresses[index], driver_buffers[index].pwm_buffer, driver_buffers[index].pwm_buffer_dirty);
 }
 
 void is31fl3731_init_drivers(void) {
@@ -180,7 +178,7 @@ void is31fl3731_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         driver_buffers[led.driver].pwm_buffer[led.r] = red;
         driver_buffers[led.driver].pwm_buffer[led.g] = green;
         driver_buffers[led.driver].pwm_buffer[led.b] = blue;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        driver_buffers[led.driver].pwm_buffer_dirty |= IS31FL3731_PWM_CHUNK_BIT(led.r) | IS31FL3731_PWM_CHUNK_BIT(led.g) | IS31FL3731_PWM_CHUNK_BIT(led.b);
     }
 }
 
@@ -224,7 +222,7 @@ void is31fl3731_update_pwm_buffers(uint8_t index) {
     if (driver_buffers[index].pwm_buffer_dirty) {
         is31fl3731_write_pwm_buffer(index);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        driver_buffers[index].pwm_buffer_dirty = 0;
     }
 }
 
@@ -243,3 +241,15 @@ void is31fl3731_flush(void) {
         is31fl3731_update_pwm_buffers(i);
     }
 }
+
+bool is31fl3731_flush_step(void) {
+    for (uint8_t index = 0; index < IS31FL3731_DRIVER_COUNT; index++) {
+        uint16_t chunk = is31fl37xx_write_pwm_chunk(&is31fl3731_chip, i2c_addresses[index], driver_buffers[index].pwm_buffer, driver_buffers[index].pwm_buffer_dirty);
+
+        if (chunk) {
+            driver_buffers[index].pwm_buffer_dirty &= ~chunk;
+            return true;
+        }
+    }
+    return false;
+}
@@ -141,6 +141,7 @@ void is31fl3736_update_pwm_buffers(uint8_t index);
 void is31fl3736_update_led_control_registers(uint8_t index);
 
 void is31fl3736_flush(void);
+bool is31fl3736_flush_step(void);
 
 #define IS31FL3736_PDR_0_OHM 0b000   // No pull-down resistor
 #define IS31FL3736_PDR_0K5_OHM 0b001 // 0.5 kOhm resistor
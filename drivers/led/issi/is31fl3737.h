@@ -134,6 +134,7 @@ void is31fl3737_update_pwm_buffers(uint8_t index);
 void is31fl3737_update_led_control_registers(uint8_t index);
 
 void is31fl3737_flush(void);
+bool is31fl3737_flush_step(void);
 
 #define IS31FL3737_PDR_0_OHM 0b000   // No pull-down resistor
 #define IS31FL3737_PDR_0K5_OHM 0b001 // 0.5 kOhm resistor
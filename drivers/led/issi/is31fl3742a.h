@@ -87,6 +87,7 @@ void is31fl3742a_update_pwm_buffers(uint8_t index);
 void is31fl3742a_update_scaling_registers(uint8_t index);
 
 void is31fl3742a_flush(void);
+bool is31fl3742a_flush_step(void);
 
 #define IS31FL3742A_PDR_0_OHM 0b000   // No pull-down resistor
 #define IS31FL3742A_PDR_0K5_OHM 0b001 // 0.5 kOhm resistor
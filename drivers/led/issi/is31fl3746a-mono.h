@@ -97,6 +97,7 @@ void is31fl3746a_update_pwm_buffers(uint8_t index);
 void is31fl3746a_update_scaling_registers(uint8_t index);
 
 void is31fl3746a_flush(void);
+bool is31fl3746a_flush_step(void);
 
 #define IS31FL3746A_PDR_0_OHM 0b000          // No pull-down resistor
 #define IS31FL3746A_PDR_0K5_OHM_SW_OFF 0b001 // 0.5 kOhm resistor in SWx off time
@@ -0,0 +1,88 @@
+/* Copyright 2024 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "is31fl37xx_common.h"
+#include "i2c_master.h"
+
+static void is31fl37xx_write(const is31fl37xx_chip_t *chip, uint8_t address, uint8_t reg, const uint8_t *data, uint16_t length) {
+    uint8_t attempts = chip->persistence > 0 ? chip->persistence : 1;
+
+    while (attempts--) {
+        if (i2c_write_register(address << 1, reg, data, length, chip->timeout) == I2C_STATUS_SUCCESS) break;
+    }
+}
+
+void is31fl37xx_write_register(const is31fl37xx_chip_t *chip, uint8_t address, uint8_t reg, uint8_t data) {
+    is31fl37xx_write(chip, address, reg, &data, 1);
+}
+
+void is31fl37xx_select_page(const is31fl37xx_chip_t *chip, uint8_t address, uint8_t page) {
+    if (chip->write_lock) {
+        is31fl37xx_write_register(chip, address, IS31FL37XX_REG_COMMAND_WRITE_LOCK, IS31FL37XX_COMMAND_WRITE_LOCK_MAGIC);
+    }
+    is31fl37xx_write_register(chip, address, IS31FL37XX_REG_COMMAND, page);
+}
+
+void is31fl37xx_write_pwm_buffer(const is31fl37xx_chip_t *chip, uint8_t address, const uint8_t *pwm_buffer, uint16_t dirty) {
+    uint8_t bit = 0;
+
+    for (uint8_t p = 0; p < chip->pwm_page_count; p++) {
+        const is31fl37xx_pwm_page_t *page     = &chip->pwm_pages[p];
+        bool                         selected = page->command == IS31FL37XX_PAGE_NONE;
+
+        // Transmit only the changed chunks, selecting the page before the first of them.
+        for (uint8_t i = 0; i < page->register_count; i += page->chunk_size, bit++) {
+            if (dirty & (1 << bit)) {
+                if (!selected) {
+                    is31fl37xx_select_page(chip, address, page->command);
+                    selected = true;
+                }
+                is31fl37xx_write(chip, address, page->first_register + i, pwm_buffer + i, page->chunk_size);
+            }
+        }
+
+        pwm_buffer += page->register_count;
+    }
+}
+
+// Transmits the first dirty chunk of the PWM buffer, and returns its bit in
+// the dirty mask, or 0 if there was nothing to transmit. The page is selected
+// every time, as other writes may have happened since the previous chunk.
+uint16_t is31fl37xx_write_pwm_chunk(const is31fl37xx_chip_t *chip, uint8_t address, const uint8_t *pwm_buffer, uint16_t dirty) {
+    uint8_t bit = 0;
+
+    if (!dirty) {
+        return 0;
+    }
+
+    for (uint8_t p = 0; p < chip->pwm_page_count; p++) {
+        const is31fl37xx_pwm_page_t *page = &chip->pwm_pages[p];
+
+        for (uint8_t i = 0; i < page->register_count; i += page->chunk_size, bit++) {
+            if (dirty & (1 << bit)) {
+                if (page->command != IS31FL37XX_PAGE_NONE) {
+                    is31fl37xx_select_page(chip, address, page->command);
+                }
+                is31fl37xx_write(chip, address, page->first_register + i, pwm_buffer + i, page->chunk_size);
+                return 1 << bit;
+            }
+        }
+
+        pwm_buffer += page->register_count;
+    }
+
+    return 0;
+}
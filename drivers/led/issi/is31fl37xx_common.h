@@ -0,0 +1,56 @@
+/* Copyright 2024 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Shared I2C transport for the IS31FL37xx family. Each chip driver describes
+// where its PWM registers live with an is31fl37xx_chip_t, and keeps its own
+// buffers, which are handed to these functions along with the I2C address.
+
+#define IS31FL37XX_REG_COMMAND 0xFD
+#define IS31FL37XX_REG_COMMAND_WRITE_LOCK 0xFE
+#define IS31FL37XX_COMMAND_WRITE_LOCK_MAGIC 0xC5
+
+// The PWM registers are always accessible, no page needs to be selected.
+#define IS31FL37XX_PAGE_NONE 0xFF
+
+#define IS31FL37XX_MAX_PWM_PAGES 2
+
+typedef struct is31fl37xx_pwm_page_t {
+    uint8_t command;        // Page to select before writing, or IS31FL37XX_PAGE_NONE
+    uint8_t first_register; // Register of the first PWM value on the page
+    uint8_t register_count;
+    uint8_t chunk_size; // Must divide register_count
+} is31fl37xx_pwm_page_t;
+
+typedef struct is31fl37xx_chip_t {
+    uint16_t              timeout;
+    uint8_t               persistence; // Attempts per write, 0 is the same as 1
+    bool                  write_lock;  // The command register must be unlocked before selecting a page
+    uint8_t               pwm_page_count;
+    is31fl37xx_pwm_page_t pwm_pages[IS31FL37XX_MAX_PWM_PAGES];
+} is31fl37xx_chip_t;
+
+void is31fl37xx_write_register(const is31fl37xx_chip_t *chip, uint8_t address, uint8_t reg, uint8_t data);
+void is31fl37xx_select_page(const is31fl37xx_chip_t *chip, uint8_t address, uint8_t page);
+
+// The PWM buffer holds the registers of all the PWM pages back to back. Its
+// dirty mask has one bit per chunk, numbered across the pages in order.
+void     is31fl37xx_write_pwm_buffer(const is31fl37xx_chip_t *chip, uint8_t address, const uint8_t *pwm_buffer, uint16_t dirty);
+uint16_t is31fl37xx_write_pwm_chunk(const is31fl37xx_chip_t *chip, uint8_t address, const uint8_t *pwm_buffer, uint16_t dirty);
@@ -235,14 +235,23 @@ void adns5050_power_down(void) {
     }
 }
 
-report_mouse_t adns5050_get_report(report_mouse_t mouse_report) {
+sensor_motion_t adns5050_get_motion(void) {
     report_adns5050_t data = adns5050_read_burst();
 
-    if (data.dx != 0 || data.dy != 0) {
-        pd_dprintf("Raw ] X: %d, Y: %d\n", data.dx, data.dy);
-        mouse_report.x = (mouse_xy_report_t)data.dx;
-        mouse_report.y = (mouse_xy_report_t)data.dy;
+    return (sensor_motion_t){
+        .dx     = data.dx,
+        .dy     = data.dy,
+        .motion = data.dx != 0 || data.dy != 0,
+        .lifted = false,
+    };
+}
+
+report_mouse_t adns5050_get_report(report_mouse_t mouse_report) {
+    sensor_motion_t motion = adns5050_get_motion();
+
+    if (motion.motion) {
+        pd_dprintf("Raw ] X: %d, Y: %d\n", motion.dx, motion.dy);
     }
 
-    return mouse_report;
+    return motion_burst_to_report(motion, mouse_report);
 }
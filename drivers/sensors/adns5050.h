@@ -22,6 +22,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "pointing_device.h"
+#include "motion_burst.h"
 
 // CPI values
 // clang-format off
@@ -82,6 +83,7 @@ void              adns5050_serial_write(uint8_t data);
 uint8_t           adns5050_read_reg(uint8_t reg_addr);
 void              adns5050_write_reg(uint8_t reg_addr, uint8_t data);
 report_adns5050_t adns5050_read_burst(void);
+sensor_motion_t   adns5050_get_motion(void);
 void              adns5050_set_cpi(uint16_t cpi);
 uint16_t          adns5050_get_cpi(void);
 int8_t            convert_twoscomp(uint8_t data);
@@ -16,6 +16,7 @@
 
 #include "spi_master.h"
 #include "adns9800.h"
+#include "motion_burst.h"
 #include "wait.h"
 
 // registers
@@ -200,55 +201,36 @@ void adns9800_set_cpi(uint16_t cpi) {
     adns9800_write(REG_Configuration_I, config_1);
 }
 
-static int16_t convertDeltaToInt(uint8_t high, uint8_t low) {
-    // join bytes into twos compliment
-    uint16_t twos_comp = (high << 8) | low;
+sensor_motion_t adns9800_get_motion(void) {
+    const motion_burst_config_t config = {
+        .cs_pin    = ADNS9800_CS_PIN,
+        .mode      = ADNS9800_SPI_MODE,
+        .divisor   = ADNS9800_SPI_DIVISOR,
+        .burst_reg = REG_Motion_Burst,
+        .tsrad_us  = US_BEFORE_MOTION,
+    };
 
-    // convert twos comp to int
-    if (twos_comp & 0x8000) return -1 * (~twos_comp + 1);
+    // Motion, Observation, Delta_X_L, Delta_X_H, Delta_Y_L, Delta_Y_H
+    uint8_t burst[6] = {0};
 
-    return twos_comp;
-}
-
-report_adns9800_t adns9800_get_report(void) {
-    report_adns9800_t report = {0};
-
-    adns9800_spi_start();
-
-    // start burst mode
-    spi_write(REG_Motion_Burst & 0x7f);
-
-    wait_us(US_BEFORE_MOTION);
-
-    uint8_t motion = spi_read();
-
-    if (motion & 0x80) {
-        // clear observation register
-        spi_read();
-
-        // delta registers
-        uint8_t delta_x_l = spi_read();
-        uint8_t delta_x_h = spi_read();
-        uint8_t delta_y_l = spi_read();
-        uint8_t delta_y_h = spi_read();
-
-        report.x = convertDeltaToInt(delta_x_h, delta_x_l);
-        report.y = convertDeltaToInt(delta_y_h, delta_y_l);
+    if (!motion_burst_read(&config, burst, sizeof(burst)) || !(burst[0] & 0x80)) {
+        return (sensor_motion_t){0};
     }
 
-    // clear residual motion
-    spi_write(REG_Motion & 0x7f);
+    return (sensor_motion_t){
+        .dx     = motion_burst_delta(burst[2], burst[3]),
+        .dy     = motion_burst_delta(burst[4], burst[5]),
+        .motion = true,
+        .lifted = false,
+    };
+}
 
-    spi_stop();
+report_adns9800_t adns9800_get_report(void) {
+    sensor_motion_t motion = adns9800_get_motion();
 
-    return report;
+    return (report_adns9800_t){motion.dx, motion.dy};
 }
 
 report_mouse_t adns9800_get_report_driver(report_mouse_t mouse_report) {
-    report_adns9800_t sensor_report = adns9800_get_report();
-
-    mouse_report.x = CONSTRAIN_HID_XY(sensor_report.x);
-    mouse_report.y = CONSTRAIN_HID_XY(sensor_report.y);
-
-    return mouse_report;
+    return motion_burst_to_report(adns9800_get_motion(), mouse_report);
 }
@@ -18,6 +18,7 @@
 
 #include <stdint.h>
 #include "pointing_device.h"
+#include "motion_burst.h"
 
 #ifndef ADNS9800_CPI
 #    define ADNS9800_CPI 1600
@@ -70,4 +71,6 @@ uint16_t          adns9800_get_cpi(void);
 void              adns9800_set_cpi(uint16_t cpi);
 /* Reads and clears the current delta values on the ADNS sensor */
 report_adns9800_t adns9800_get_report(void);
+/* Reads and clears the current motion of the ADNS sensor, with a single burst read */
+sensor_motion_t   adns9800_get_motion(void);
 report_mouse_t    adns9800_get_report_driver(report_mouse_t mouse_report);
@@ -0,0 +1,24 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "motion_burst.h"
+#include "spi_master.h"
+#include "wait.h"
+
+bool motion_burst_read(const motion_burst_config_t *config, void *data, uint16_t length) {
+    if (!spi_start(config->cs_pin, false, config->mode, config->divisor)) {
+        spi_stop();
+        return false;
+    }
+    // tNCS-SCLK
+    wait_us(1);
+
+    // the address byte has the MSBit cleared, as for any register read
+    bool success = spi_write(config->burst_reg & 0x7f) >= 0;
+    wait_us(config->tsrad_us);
+    success = success && spi_receive((uint8_t *)data, length) == SPI_STATUS_SUCCESS;
+
+    // raising NCS ends the burst
+    spi_stop();
+    return success;
+}
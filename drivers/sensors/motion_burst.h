@@ -0,0 +1,72 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "gpio.h"
+#include "pointing_device.h"
+
+/**
+ * @brief Motion latched by an optical sensor, common to all sensor drivers
+ * that support burst reads.
+ */
+typedef struct {
+    int16_t dx;     // displacement since the last read, in counts
+    int16_t dy;     // displacement since the last read, in counts
+    bool    motion; // the sensor has seen motion since the last read
+    bool    lifted; // the sensor is lifted off the surface
+} sensor_motion_t;
+
+/**
+ * @brief Settings of a sensor's motion burst register and its SPI bus
+ */
+typedef struct {
+    pin_t    cs_pin;
+    uint8_t  mode;
+    uint16_t divisor;
+    uint8_t  burst_reg; // address of the motion burst register
+    uint16_t tsrad_us;  // delay between the address and the first data byte
+} motion_burst_config_t;
+
+/**
+ * @brief Reads `length` bytes of motion burst data from the sensor in a single
+ * SPI transaction.
+ *
+ * The data bytes are received as one block, which uses DMA where the SPI
+ * driver supports it, instead of one transfer per byte.
+ *
+ * NOTE: Only available for SPI sensors
+ *
+ * @param config motion burst settings of the sensor
+ * @param data buffer to receive the burst into
+ * @param length number of bytes to read
+ * @return true the burst was read
+ * @return false the SPI bus could not be started or the transfer failed
+ */
+bool motion_burst_read(const motion_burst_config_t *config, void *data, uint16_t length);
+
+/**
+ * @brief Joins the low and high byte of a delta register into a signed count
+ */
+static inline int16_t motion_burst_delta(uint8_t low, uint8_t high) {
+    return (int16_t)(((uint16_t)high << 8) | low);
+}
+
+/**
+ * @brief Moves the motion of a sensor into a mouse report, clamped to the
+ * report range, or into the pointing device accumulator when coalescing.
+ */
+static inline report_mouse_t motion_burst_to_report(sensor_motion_t motion, report_mouse_t mouse_report) {
+    if (!motion.motion || motion.lifted) {
+        return mouse_report;
+    }
+#ifdef POINTING_DEVICE_MOTION_COALESCE
+    pointing_device_accumulate_motion(motion.dx, motion.dy);
+#else
+    mouse_report.x = CONSTRAIN_HID_XY(motion.dx);
+    mouse_report.y = CONSTRAIN_HID_XY(motion.dy);
+#endif
+    return mouse_report;
+}
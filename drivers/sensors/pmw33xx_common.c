@@ -212,22 +212,22 @@ pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor) {
         in_burst[sensor] = true;
     }
 
-    if (!pmw33xx_spi_start(sensor)) {
-        return report;
+    const motion_burst_config_t config = {
+        .cs_pin    = cs_pins[sensor],
+        .mode      = 3,
+        .divisor   = PMW33XX_SPI_DIVISOR,
+        .burst_reg = REG_Motion_Burst,
+        .tsrad_us  = 35, // tSRAD_MOTBR
+    };
+    if (!motion_burst_read(&config, &report, sizeof(report))) {
+        return (pmw33xx_report_t){0};
     }
 
-    spi_write(REG_Motion_Burst);
-    wait_us(35); // waits for tSRAD_MOTBR
-
-    spi_receive((uint8_t *)&report, sizeof(report));
-
     // panic recovery, sometimes burst mode works weird.
     if (report.motion.w & 0b111) {
         in_burst[sensor] = false;
     }
 
-    spi_stop();
-
     pd_dprintf("PMW33XX (%d): motion: 0x%x dx: %i dy: %i\n", sensor, report.motion.w, report.delta_x, report.delta_y);
 
     report.delta_x *= -1;
@@ -248,25 +248,27 @@ uint16_t pmw33xx_get_cpi_wrapper(void) {
     return pmw33xx_get_cpi(0);
 }
 
-report_mouse_t pmw33xx_get_report(report_mouse_t mouse_report) {
-    pmw33xx_report_t report    = pmw33xx_read_burst(0);
-    static bool      in_motion = false;
+sensor_motion_t pmw33xx_get_motion(uint8_t sensor) {
+    pmw33xx_report_t report = pmw33xx_read_burst(sensor);
 
-    if (report.motion.b.is_lifted) {
-        return mouse_report;
-    }
+    return (sensor_motion_t){
+        .dx     = report.delta_x,
+        .dy     = report.delta_y,
+        .motion = report.motion.b.is_motion,
+        .lifted = report.motion.b.is_lifted,
+    };
+}
 
-    if (!report.motion.b.is_motion) {
-        in_motion = false;
-        return mouse_report;
-    }
+report_mouse_t pmw33xx_get_report(report_mouse_t mouse_report) {
+    sensor_motion_t motion    = pmw33xx_get_motion(0);
+    static bool     in_motion = false;
 
-    if (!in_motion) {
+    if (!motion.motion || motion.lifted) {
+        in_motion = false;
+    } else if (!in_motion) {
         in_motion = true;
         pd_dprintf("PWM3360 (0): starting motion\n");
     }
 
-    mouse_report.x = CONSTRAIN_HID_XY(report.delta_x);
-    mouse_report.y = CONSTRAIN_HID_XY(report.delta_y);
-    return mouse_report;
+    return motion_burst_to_report(motion, mouse_report);
 }
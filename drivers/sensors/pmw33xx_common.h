@@ -15,6 +15,7 @@
 #include "spi_master.h"
 #include "util.h"
 #include "pointing_device.h"
+#include "motion_burst.h"
 
 #if defined(POINTING_DEVICE_DRIVER_pmw3360)
 #    include "pmw3360.h"
@@ -156,6 +157,16 @@ void pmw33xx_set_cpi_all_sensors(uint16_t cpi);
  */
 pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor);
 
+/**
+ * @brief Reads and clears the current motion of the given sensor, with a
+ * single burst read.
+ *
+ * @param sensor Index of the sensors chip select pin
+ * @return sensor_motion_t Current motion of the sensor, if errors occurred all
+ * fields are set to zero
+ */
+sensor_motion_t pmw33xx_get_motion(uint8_t sensor);
+
 /**
  * @brief Read one byte of data from the given register on the sensor
  *
@@ -4,3 +4,4 @@ COMMON_VPATH += $(DRIVER_PATH)/issi
 SRC +=  drivers/led/issi/is31fl3731.c
 
 I2C_DRIVER_REQUIRED = yes
+IS31FL37XX_DRIVER_REQUIRED = yes
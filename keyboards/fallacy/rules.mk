@@ -2,3 +2,4 @@
 SRC += indicators.c \
        drivers/led/issi/is31fl3731-mono.c
 I2C_DRIVER_REQUIRED = yes
+IS31FL37XX_DRIVER_REQUIRED = yes
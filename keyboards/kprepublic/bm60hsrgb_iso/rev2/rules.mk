@@ -4,4 +4,5 @@
 COMMON_VPATH += $(DRIVER_PATH)/led/issi
 SRC += is31fl3733.c
 I2C_DRIVER_REQUIRED = yes
+IS31FL37XX_DRIVER_REQUIRED = yes
 WS2812_DRIVER_REQUIRED = yes
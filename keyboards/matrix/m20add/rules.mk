@@ -6,3 +6,4 @@ CUSTOM_MATRIX = lite
 # project specific files
 SRC += matrix.c tca6424.c rgb_ring.c drivers/led/issi/is31fl3731.c
 I2C_DRIVER_REQUIRED = yes
+IS31FL37XX_DRIVER_REQUIRED = yes
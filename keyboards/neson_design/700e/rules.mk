@@ -1,3 +1,4 @@
 QUANTUM_LIB_SRC += drivers/led/issi/is31fl3731.c
 WS2812_DRIVER_REQUIRED = yes
 I2C_DRIVER_REQUIRED = yes
+IS31FL37XX_DRIVER_REQUIRED = yes
@@ -1,4 +1,5 @@
 I2C_DRIVER_REQUIRED = yes
+IS31FL37XX_DRIVER_REQUIRED = yes
 
 # project specific files
 SRC =	drivers/led/issi/is31fl3736-mono.c \
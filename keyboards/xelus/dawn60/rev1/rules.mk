@@ -5,6 +5,7 @@ NO_SUSPEND_POWER_DOWN = yes
 
 CIE1931_CURVE = yes
 I2C_DRIVER_REQUIRED = yes
+IS31FL37XX_DRIVER_REQUIRED = yes
 WS2812_DRIVER_REQUIRED = yes
 
 # project specific files
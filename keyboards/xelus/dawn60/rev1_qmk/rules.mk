@@ -4,6 +4,7 @@
 NO_SUSPEND_POWER_DOWN = yes
 
 I2C_DRIVER_REQUIRED = yes
+IS31FL37XX_DRIVER_REQUIRED = yes
 WS2812_DRIVER_REQUIRED = yes
 
 # project specific files
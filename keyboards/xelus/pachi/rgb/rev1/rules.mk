@@ -1,4 +1,5 @@
 COMMON_VPATH += $(DRIVER_PATH)/issi
 SRC += drivers/led/issi/is31fl3741.c
+IS31FL37XX_DRIVER_REQUIRED = yes
 
 OPT = 2
@@ -13,8 +13,8 @@
 # limitations under the License.
 """Python program to make autocorrect_data.h.
 This program reads from a prepared dictionary file and generates a C source file
-"autocorrect_data.h" with a serialized trie embedded as an array. Run this
-program and pass it as the first argument like:
+"autocorrect_data.h" with a serialized DAWG (a trie with shared suffixes)
+embedded as an array. Run this program and pass it as the first argument like:
 $ qmk generate-autocorrect-data autocorrect_dict.txt
 Each line of the dict file defines one typo and its correction with the syntax
 "typo -> correction". Blank lines or lines starting with '#' are ignored.
@@ -28,6 +28,7 @@ For full documentation, see QMK Docs
 """
 
 import textwrap
+from collections import deque
 from typing import Any, Dict, Iterator, List, Tuple
 
 from milc import cli
@@ -108,7 +109,7 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
 
 
 def make_trie(autocorrections: List[Tuple[str, str]]) -> Dict[str, Any]:
-    """Makes a trie from the the typos, writing in reverse.
+    """Makes a trie from the the typos, in the order they are typed.
   Args:
     autocorrections: List of (typo, correction) tuples.
   Returns:
@@ -117,13 +118,63 @@ def make_trie(autocorrections: List[Tuple[str, str]]) -> Dict[str, Any]:
     trie = {}
     for typo, correction in autocorrections:
         node = trie
-        for letter in typo[::-1]:
+        for letter in typo:
             node = node.setdefault(letter, {})
         node['LEAF'] = (typo, correction)
 
     return trie
 
 
+def make_dawg(trie: Dict[str, Any]) -> Dict[str, Any]:
+    """Merges identical subtrees of the trie, so that typos ending the same way
+  share their nodes. The result is a directed acyclic word graph (DAWG).
+  Args:
+    trie: Dict of dicts, as returned by make_trie.
+  Returns:
+    Root node of the DAWG. Nodes are dicts with either 'children', a dict of
+    letter to node, or 'leaf', the (backspaces, correction) tuple of a typo.
+  """
+    registry = {}
+
+    def minimize(trie_node):
+        if 'LEAF' in trie_node:
+            leaf = leaf_data(*trie_node['LEAF'])
+            return registry.setdefault(('LEAF', ) + leaf, {'leaf': leaf})
+        children = {c: minimize(trie_node[c]) for c in trie_node}
+        signature = tuple((c, id(children[c])) for c in sorted(children))
+        return registry.setdefault(signature, {'children': children})
+
+    return minimize(trie)
+
+
+def count_active_states(trie: Dict[str, Any]) -> int:
+    """Finds the most typo prefixes that the typed text can end in at once.
+  These are the nodes that need to be advanced on every key press. Using
+  Aho-Corasick failure links, they are the nodes on the failure chain of the
+  node for the longest such prefix.
+  Args:
+    trie: Dict of dicts, as returned by make_trie.
+  Returns:
+    Maximum number of nodes the matcher tracks at the same time.
+  """
+    fail = {id(trie): (None, 0)}  # Failure target and length of the failure chain of each node.
+    most = 0
+    queue = deque((trie[c], c, trie) for c in trie if c != 'LEAF')
+
+    while queue:
+        node, c, parent = queue.popleft()
+        target = fail[id(parent)][0]
+        while target is not None and c not in target:
+            target = fail[id(target)][0]
+        target = target[c] if target is not None else trie
+        chain = fail[id(target)][1] + 1
+        fail[id(node)] = (target, chain)
+        most = max(most, chain)
+        queue.extend((node[k], k, node) for k in node if k != 'LEAF')
+
+    return most
+
+
 def parse_file_lines(file_name: str) -> Iterator[Tuple[int, str, str]]:
     """Parses lines read from `file_name` into typo-correction pairs."""
 
@@ -165,69 +216,69 @@ def check_typo_against_dictionary(typo: str, line_number: int, correct_words) ->
                 cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" would falsely trigger on correctly spelled word "{fg_cyan}%s{fg_reset}".', line_number, typo, word)
 
 
-def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any]) -> List[int]:
-    """Serializes trie and correction data in a form readable by the C code.
+def leaf_data(typo: str, correction: str) -> Tuple[int, str]:
+    """Computes how many backspaces to type after `typo` and what to type next to correct it."""
+    word_boundary_ending = typo[-1] == ':'
+    typo = typo.strip(':')
+    i = 0
+    while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+        i += 1
+    backspaces = len(typo) - i - 1 + word_boundary_ending
+    assert 0 <= backspaces <= 63
+    return backspaces, correction[i:]
+
+
+def serialize_dawg(root: Dict[str, Any]) -> List[int]:
+    """Serializes DAWG and correction data in a form readable by the C code.
+  Nodes are laid out depth first. A node is stored once, the first time it is
+  reached, and directly followed by its first child when possible so that
+  only the links to the other children need to be stored.
   Args:
-    autocorrections: List of (typo, correction) tuples.
-    trie: Dict of dicts.
+    root: Root node, as returned by make_dawg.
   Returns:
     List of ints in the range 0-255.
   """
     table = []
-
-    # Traverse trie in depth first order.
-    def traverse(trie_node):
-        if 'LEAF' in trie_node:  # Handle a leaf trie node.
-            typo, correction = trie_node['LEAF']
-            word_boundary_ending = typo[-1] == ':'
-            typo = typo.strip(':')
-            i = 0  # Make the autocorrection data for this entry and serialize it.
-            while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
-                i += 1
-            backspaces = len(typo) - i - 1 + word_boundary_ending
-            assert 0 <= backspaces <= 63
-            correction = correction[i:]
-            bs_count = [backspaces + 128]
-            data = bs_count + list(bytes(correction, 'ascii')) + [0]
-
-            entry = {'data': data, 'links': [], 'byte_offset': 0}
-            table.append(entry)
-        elif len(trie_node) == 1:  # Handle trie node with a single child.
-            c, trie_node = next(iter(trie_node.items()))
-            entry = {'chars': c, 'byte_offset': 0}
-
-            # It's common for a trie to have long chains of single-child nodes. We
-            # find the whole chain so that we can serialize it more efficiently.
-            while len(trie_node) == 1 and 'LEAF' not in trie_node:
-                c, trie_node = next(iter(trie_node.items()))
-                entry['chars'] += c
-
-            table.append(entry)
-            entry['links'] = [traverse(trie_node)]
-        else:  # Handle trie node with multiple children.
-            entry = {'chars': ''.join(sorted(trie_node.keys())), 'byte_offset': 0}
-            table.append(entry)
-            entry['links'] = [traverse(trie_node[c]) for c in entry['chars']]
-        return entry
-
-    traverse(trie)
+    placed = set()
+
+    def traverse(node):
+        placed.add(id(node))
+        entry = {'node': node, 'byte_offset': 0}
+        table.append(entry)
+        node['entry'] = entry
+
+        if 'leaf' in node:  # Handle a leaf node.
+            backspaces, correction = node['leaf']
+            entry['data'] = [backspaces + 128] + list(bytes(correction, 'ascii')) + [0]
+            entry['links'] = []
+            return
+
+        chars = sorted(node['children'].keys(), key=TYPO_CHARS.get)
+        children = [node['children'][c] for c in chars]
+        inline = id(children[0]) not in placed
+        if len(chars) == 1 and inline:  # Handle a chain node, its child follows.
+            entry['data'] = [TYPO_CHARS[chars[0]]]
+            entry['links'] = []
+        else:  # Handle a branch node.
+            entry['data'] = [64 + (32 if inline else 0) + len(chars)] + [TYPO_CHARS[c] for c in chars]
+            entry['links'] = children[1:] if inline else children
+
+        for child in children:
+            if id(child) not in placed:
+                traverse(child)
+
+    traverse(root)
 
     def serialize(e: Dict[str, Any]) -> List[int]:
-        if not e['links']:  # Handle a leaf table entry.
-            return e['data']
-        elif len(e['links']) == 1:  # Handle a chain table entry.
-            return [TYPO_CHARS[c] for c in e['chars']] + [0]  # + encode_link(e['links'][0]))
-        else:  # Handle a branch table entry.
-            data = []
-            for c, link in zip(e['chars'], e['links']):
-                data += [TYPO_CHARS[c] | (0 if data else 64)] + encode_link(link)
-            return data + [0]
+        data = list(e['data'])
+        for link in e['links']:
+            data += encode_link(link['entry'])
+        return data
 
     byte_offset = 0
     for e in table:  # To encode links, first compute byte offset of each entry.
         e['byte_offset'] = byte_offset
-        byte_offset += len(serialize(e))
-        assert 0 <= byte_offset <= 0xffff
+        byte_offset += len(e['data']) + 2 * len(e['links'])
 
     return [b for e in table for b in serialize(e)]  # Serialize final table.
 
@@ -258,7 +309,8 @@ def to_hex(b: int) -> str:
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
     trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
+    data = serialize_dawg(make_dawg(trie))
+    active_states = count_active_states(trie)
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -281,11 +333,15 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
-    autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
+    autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)} // {len(data) / len(autocorrections):.1f} bytes per entry')
+    autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_ACTIVE_STATES {active_states} // node lookups per key press: {active_states + 1}')
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
     autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
     autocorrect_data_h_lines.append('};')
 
+    if not cli.args.quiet:
+        cli.log.info('Autocorrection data for %d entries uses %d bytes (%.1f bytes per entry), at most %d node lookups per key press.', len(autocorrections), len(data), len(data) / len(autocorrections), active_states + 1)
+
     # Show the results
     dump_lines(cli.args.output, autocorrect_data_h_lines, cli.args.quiet)
@@ -44,6 +44,7 @@ def _gen_led_config(info_data, config_type):
     if config_type == 'rgb_matrix':
         lines.append('#ifdef RGB_MATRIX_ENABLE')
         lines.append('#include "rgb_matrix.h"')
+        lines.append('#include "progmem.h"')
     elif config_type == 'led_matrix':
         lines.append('#ifdef LED_MATRIX_ENABLE')
         lines.append('#include "led_matrix.h"')
@@ -56,12 +57,100 @@ def _gen_led_config(info_data, config_type):
     lines.append(f'  {{ {", ".join(pos)} }},')
     lines.append(f'  {{ {", ".join(flags)} }},')
     lines.append('};')
+    if config_type == 'rgb_matrix':
+        lines.extend(_gen_led_geometry(info_data))
+        lines.extend(_gen_led_distances(info_data))
     lines.append('#endif')
     lines.append('')
 
     return lines
 
 
+def _c_div(numerator, denominator):
+    """Integer division truncating towards zero, like C.
+    """
+    quotient = abs(numerator) // abs(denominator)
+    return quotient if (numerator < 0) == (denominator < 0) else -quotient
+
+
+def _sqrt16(x):
+    """Port of lib8tion's sqrt16(), including its truncation to 16 bit.
+    """
+    x &= 0xFFFF
+    if x <= 1:
+        return x
+
+    low = 1
+    hi = 255 if x > 7904 else (x >> 5) + 8
+    while True:
+        mid = (low + hi) >> 1
+        if (mid * mid) & 0xFFFF > x:
+            hi = mid - 1
+        else:
+            if mid == 255:
+                return 255
+            low = mid + 1
+        if hi < low:
+            return low - 1
+
+
+def _atan2_8(dy, dx):
+    """Port of lib8tion's atan2_8().
+    """
+    if dy == 0:
+        return 0 if dx >= 0 else 128
+
+    abs_y = abs(dy)
+    if dx >= 0:
+        a = 32 - _c_div(32 * (dx - abs_y), dx + abs_y)
+    else:
+        a = 96 - _c_div(32 * (dx + abs_y), abs_y - dx)
+
+    return (-a if dy < 0 else a) & 0xFF
+
+
+def _gen_led_geometry(info_data):
+    """Convert info.json content to g_rgb_matrix_geometry, the offset, distance and angle of each LED from the center
+    """
+    center_x, center_y = info_data['rgb_matrix'].get('center_point', [112, 32])
+
+    geometry = []
+    for led_data in info_data['rgb_matrix']['layout']:
+        dx = led_data.get('x', 0) - center_x
+        dy = led_data.get('y', 0) - center_y
+        geometry.append(f'{{{dx}, {dy}, {_sqrt16(dx * dx + dy * dy)}, {_atan2_8(dy, dx)}}}')
+
+    lines = []
+    lines.append('#ifdef RGB_MATRIX_GEOMETRY_TABLE')
+    lines.append('__attribute__ ((weak)) const led_geometry_t g_rgb_matrix_geometry[RGB_MATRIX_LED_COUNT] PROGMEM = {')
+    lines.append(f'  {", ".join(geometry)}')
+    lines.append('};')
+    lines.append('#endif')
+
+    return lines
+
+
+def _gen_led_distances(info_data):
+    """Convert info.json content to g_rgb_matrix_distance, the distance between every two LEDs for the reactive splash effects
+    """
+    points = [(led_data.get('x', 0), led_data.get('y', 0)) for led_data in info_data['rgb_matrix']['layout']]
+
+    lines = []
+    lines.append('#if defined(RGB_MATRIX_KEYREACTIVE_ENABLED) && defined(RGB_MATRIX_SPLASH_DISTANCE_TABLE)')
+    lines.append('__attribute__ ((weak)) const uint8_t g_rgb_matrix_distance[RGB_MATRIX_LED_COUNT * (RGB_MATRIX_LED_COUNT - 1) / 2] PROGMEM = {')
+    for a in range(1, len(points)):
+        distances = []
+        for b in range(a):
+            dx = points[a][0] - points[b][0]
+            dy = points[a][1] - points[b][1]
+            distances.append(str(_sqrt16(dx * dx + dy * dy)))
+        lines.append(f'  {", ".join(distances)},')
+    lines.append('};')
+    lines.append('#endif')
+
+    return lines
+
+
 def _gen_matrix_mask(info_data):
     """Convert info.json content to matrix_mask
     """
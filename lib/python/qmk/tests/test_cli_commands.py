@@ -289,6 +289,14 @@ def test_generate_rgb_breathe_table():
     assert 'Breathing max:    127' in result.stdout
 
 
+def test_generate_autocorrect_data():
+    result = check_subcommand('generate-autocorrect-data', '-q', 'lib/python/qmk/tests/autocorrect_dict.txt')
+    check_returncode(result)
+    assert '#define AUTOCORRECT_MAX_LENGTH 6 // ":thier"' in result.stdout
+    assert '#define DICTIONARY_SIZE 59 // 11.8 bytes per entry' in result.stdout
+    assert '#define AUTOCORRECT_MAX_ACTIVE_STATES 2 // node lookups per key press: 3' in result.stdout
+
+
 def test_generate_config_h():
     result = check_subcommand('generate-config-h', '-kb', 'handwired/pytest/basic')
     check_returncode(result)
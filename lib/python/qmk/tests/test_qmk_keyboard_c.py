@@ -0,0 +1,63 @@
+from qmk.cli.generate.keyboard_c import _atan2_8, _gen_led_distances, _sqrt16
+
+# Results of lib8tion's sqrt16() and atan2_8()
+SQRT16 = [
+    (0, 0),
+    (1, 1),
+    (2, 1),
+    (3, 1),
+    (4, 2),
+    (25, 5),
+    (50, 7),
+    (99, 9),
+    (100, 10),
+    (7904, 88),
+    (7905, 88),
+    (12544, 112),
+    (65025, 255),
+    (65535, 255),
+]
+
+ATAN2_8 = [
+    (0, 0, 0),
+    (0, 10, 0),
+    (0, -10, 128),
+    (10, 0, 64),
+    (-10, 0, 192),
+    (10, 10, 32),
+    (-10, 10, 224),
+    (10, -10, 96),
+    (-10, -10, 160),
+    (3, 7, 20),
+    (-112, 32, 207),
+    (32, -112, 113),
+    (-1, -200, 129),
+]
+
+
+def test_sqrt16():
+    for x, root in SQRT16:
+        assert _sqrt16(x) == root, x
+
+
+def test_sqrt16_truncates_to_16_bit():
+    # sqrt16() takes a uint16_t, dx * dx + dy * dy above that wraps around
+    assert _sqrt16(65536 + 100) == 10
+
+
+def test_atan2_8():
+    for dy, dx, angle in ATAN2_8:
+        assert _atan2_8(dy, dx) == angle, (dy, dx)
+
+
+def test_gen_led_distances():
+    layout = [{'x': 0, 'y': 0}, {'x': 3, 'y': 4}, {'x': 224, 'y': 64}, {'y': 10}]
+    lines = _gen_led_distances({'rgb_matrix': {'layout': layout}})
+
+    # One row per LED after the first, with its distance to each of the LEDs before it
+    rows = [[int(d) for d in line.strip().rstrip(',').split(', ')] for line in lines[2:-2]]
+    assert rows == [
+        [5],
+        [_sqrt16(224 * 224 + 64 * 64), _sqrt16(221 * 221 + 60 * 60)],
+        [10, _sqrt16(3 * 3 + 6 * 6), _sqrt16(224 * 224 + 54 * 54)],
+    ]
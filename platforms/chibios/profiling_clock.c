@@ -0,0 +1,38 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <ch.h>
+#include <hal.h>
+
+#include "profiling.h"
+
+#if defined(HAL_IMPLEMENTS_COUNTERS)
+// Cycle counter (DWT CYCCNT on ARMv7-M), clocked from HCLK
+#    ifndef PROFILING_CLOCK_HZ
+#        define PROFILING_CLOCK_HZ halGetCounterFrequency()
+#    endif
+#    define PROFILING_CLOCK_READ() ((uint32_t)halGetCounterValue())
+#else
+// No cycle counter, fall back to the system tick
+#    ifndef PROFILING_CLOCK_HZ
+#        define PROFILING_CLOCK_HZ CH_CFG_ST_FREQUENCY
+#    endif
+#    define PROFILING_CLOCK_READ() ((uint32_t)chVTGetSystemTimeX())
+#endif
+
+void profiling_clock_init(void) {
+#if defined(HAL_IMPLEMENTS_COUNTERS) && defined(DWT) && defined(__CORTEX_M) && (__CORTEX_M >= 3)
+    // The port normally enables the cycle counter already, make sure of it
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+uint32_t profiling_clock_read(void) {
+    return PROFILING_CLOCK_READ();
+}
+
+uint32_t profiling_clock_ticks_to_ns(uint32_t ticks) {
+    uint64_t ns = (uint64_t)ticks * 1000000000ULL / (PROFILING_CLOCK_HZ);
+    return ns > UINT32_MAX ? UINT32_MAX : (uint32_t)ns;
+}
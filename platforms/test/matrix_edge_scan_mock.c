@@ -0,0 +1,104 @@
+/* Copyright 2024 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+#include "matrix_edge_scan_mock.h"
+
+#define MOCK_PINS (MATRIX_ROWS + MATRIX_COLS)
+#define MOCK_COL_PIN(col) (MATRIX_ROWS + (col))
+
+static bool                 pin_is_output[MOCK_PINS];
+static bool                 pin_level[MOCK_PINS];
+static bool                 switches[MATRIX_ROWS][MATRIX_COLS];
+static mock_line_callback_t line_callbacks[MOCK_PINS];
+static uint32_t             pin_reads;
+
+static bool col_level(uint8_t col) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        // a closed switch on a driven row pulls the column low through its diode
+        if (switches[row][col] && pin_is_output[row] && !pin_level[row]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void update_switch(uint8_t row, uint8_t col, bool closed) {
+    bool before        = col_level(col);
+    switches[row][col] = closed;
+
+    mock_line_callback_t callback = line_callbacks[MOCK_COL_PIN(col)];
+    if (callback && before && !col_level(col)) {
+        callback(NULL);
+    }
+}
+
+void mock_set_pin_output(pin_t pin) {
+    pin_is_output[pin] = true;
+}
+
+void mock_set_pin_input_high(pin_t pin) {
+    pin_is_output[pin] = false;
+    pin_level[pin]     = true;
+}
+
+void mock_write_pin(pin_t pin, bool level) {
+    pin_level[pin] = level;
+}
+
+bool mock_read_pin(pin_t pin) {
+    pin_reads++;
+    if (pin >= MATRIX_ROWS) {
+        return col_level(pin - MATRIX_ROWS);
+    }
+    return pin_level[pin];
+}
+
+void mock_line_enable(pin_t pin, mock_line_callback_t callback) {
+    line_callbacks[pin] = callback;
+}
+
+void mock_line_disable(pin_t pin) {
+    line_callbacks[pin] = NULL;
+}
+
+void mock_matrix_reset(void) {
+    memset(pin_is_output, 0, sizeof(pin_is_output));
+    memset(pin_level, 1, sizeof(pin_level));
+    memset(switches, 0, sizeof(switches));
+    memset(line_callbacks, 0, sizeof(line_callbacks));
+    pin_reads = 0;
+}
+
+void mock_press(uint8_t row, uint8_t col) {
+    update_switch(row, col, true);
+}
+
+void mock_release(uint8_t row, uint8_t col) {
+    update_switch(row, col, false);
+}
+
+uint32_t mock_pin_reads(void) {
+    return pin_reads;
+}
+
+uint8_t mock_lines_enabled(void) {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < MOCK_PINS; i++) {
+        count += line_callbacks[i] != NULL;
+    }
+    return count;
+}
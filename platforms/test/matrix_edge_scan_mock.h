@@ -0,0 +1,67 @@
+/* Copyright 2024 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Simulated COL2ROW matrix: rows are driven on pins 0..3, columns are read on pins 4..7 */
+#define MATRIX_ROWS 4
+#define MATRIX_COLS 4
+#define MATRIX_ROW_PINS \
+    { 0, 1, 2, 3 }
+#define MATRIX_COL_PINS \
+    { 4, 5, 6, 7 }
+#define DIODE_DIRECTION COL2ROW
+#define DEBOUNCE 5
+#define MATRIX_EDGE_SCAN
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint8_t pin_t;
+
+typedef void (*mock_line_callback_t)(void *arg);
+
+#define gpio_set_pin_output(pin) mock_set_pin_output(pin)
+#define gpio_set_pin_input_high(pin) mock_set_pin_input_high(pin)
+#define gpio_write_pin_low(pin) mock_write_pin(pin, false)
+#define gpio_write_pin_high(pin) mock_write_pin(pin, true)
+#define gpio_read_pin(pin) mock_read_pin(pin)
+
+#ifdef MATRIX_EDGE_SCAN_INTERRUPT
+#    define matrix_edge_line_enable(pin, callback) mock_line_enable(pin, callback)
+#    define matrix_edge_line_disable(pin) mock_line_disable(pin)
+#endif
+
+void mock_set_pin_output(pin_t pin);
+void mock_set_pin_input_high(pin_t pin);
+void mock_write_pin(pin_t pin, bool level);
+bool mock_read_pin(pin_t pin);
+
+void mock_line_enable(pin_t pin, mock_line_callback_t callback);
+void mock_line_disable(pin_t pin);
+
+void     mock_matrix_reset(void);
+void     mock_press(uint8_t row, uint8_t col);
+void     mock_release(uint8_t row, uint8_t col);
+uint32_t mock_pin_reads(void);
+uint8_t  mock_lines_enabled(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,122 @@
+/* Copyright 2024 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+#include "debounce.h"
+#include "matrix_edge_scan_mock.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+class MatrixEdgeScan : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_matrix_reset();
+        set_time(0);
+        matrix_init();
+    }
+
+    void TearDown() override {
+        debounce_free();
+    }
+
+    bool scan_for(uint32_t ms) {
+        bool changed = false;
+        for (uint32_t i = 0; i < ms; i++) {
+            changed |= matrix_scan();
+            advance_time(1);
+        }
+        return changed;
+    }
+};
+
+TEST_F(MatrixEdgeScan, IdleLoopsSkipFullWalk) {
+    // the first scan walks the matrix and arms it
+    matrix_scan();
+    uint32_t full_scans = matrix_edge_scan_full_count();
+    uint32_t pin_reads  = mock_pin_reads();
+
+    EXPECT_FALSE(scan_for(100));
+    EXPECT_EQ(matrix_edge_scan_full_count(), full_scans);
+#ifdef MATRIX_EDGE_SCAN_INTERRUPT
+    EXPECT_EQ(mock_lines_enabled(), MATRIX_COLS);
+    EXPECT_EQ(mock_pin_reads(), pin_reads);
+#else
+    // a polled idle check only samples the column lines once
+    EXPECT_EQ(mock_pin_reads() - pin_reads, 100u * MATRIX_COLS);
+#endif
+}
+
+TEST_F(MatrixEdgeScan, PressWakesMatrixAndDebounces) {
+    scan_for(10);
+    uint32_t full_scans = matrix_edge_scan_full_count();
+
+    mock_press(1, 2);
+    EXPECT_FALSE(matrix_scan());
+    EXPECT_EQ(matrix_edge_scan_full_count(), full_scans + 1);
+    EXPECT_FALSE(matrix_is_on(1, 2));
+#ifdef MATRIX_EDGE_SCAN_INTERRUPT
+    EXPECT_EQ(mock_lines_enabled(), 0);
+#endif
+
+    advance_time(1);
+    EXPECT_TRUE(scan_for(DEBOUNCE));
+    EXPECT_TRUE(matrix_is_on(1, 2));
+    EXPECT_FALSE(matrix_is_on(2, 1));
+}
+
+TEST_F(MatrixEdgeScan, HeldKeyKeepsWalking) {
+    mock_press(0, 0);
+    scan_for(DEBOUNCE + 1);
+    EXPECT_TRUE(matrix_is_on(0, 0));
+
+    uint32_t full_scans = matrix_edge_scan_full_count();
+    EXPECT_FALSE(scan_for(50));
+    EXPECT_EQ(matrix_edge_scan_full_count(), full_scans + 50);
+}
+
+TEST_F(MatrixEdgeScan, ReleaseRearmsAfterDebounce) {
+    mock_press(3, 3);
+    scan_for(DEBOUNCE + 1);
+    EXPECT_TRUE(matrix_is_on(3, 3));
+
+    mock_release(3, 3);
+    EXPECT_TRUE(scan_for(DEBOUNCE + 1));
+    EXPECT_FALSE(matrix_is_on(3, 3));
+
+    uint32_t full_scans = matrix_edge_scan_full_count();
+    EXPECT_FALSE(scan_for(50));
+    EXPECT_EQ(matrix_edge_scan_full_count(), full_scans);
+}
+
+TEST_F(MatrixEdgeScan, BouncingPressStaysAwakeUntilSettled) {
+    scan_for(10);
+
+    mock_press(2, 1);
+    matrix_scan();
+    advance_time(1);
+    mock_release(2, 1);
+    matrix_scan();
+    advance_time(1);
+    mock_press(2, 1);
+
+    EXPECT_TRUE(scan_for(DEBOUNCE + 1));
+    EXPECT_TRUE(matrix_is_on(2, 1));
+}
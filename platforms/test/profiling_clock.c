@@ -0,0 +1,20 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <time.h>
+
+#include "profiling.h"
+
+// Host monotonic clock, one tick per nanosecond
+
+void profiling_clock_init(void) {}
+
+uint32_t profiling_clock_read(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+
+uint32_t profiling_clock_ticks_to_ns(uint32_t ticks) {
+    return ticks;
+}
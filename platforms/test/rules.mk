@@ -23,3 +23,17 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+matrix_edge_scan_DEFS := -DIGNORE_ATOMIC_BLOCK -DNO_PRINT -DNO_DEBUG
+matrix_edge_scan_CONFIG := $(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_edge_scan_mock.h
+matrix_edge_scan_interrupt_DEFS := $(matrix_edge_scan_DEFS) -DMATRIX_EDGE_SCAN_INTERRUPT
+matrix_edge_scan_interrupt_CONFIG := $(matrix_edge_scan_CONFIG)
+
+matrix_edge_scan_SRC := \
+	$(QUANTUM_PATH)/matrix.c \
+	$(QUANTUM_PATH)/matrix_common.c \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_edge_scan_mock.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_edge_scan_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+matrix_edge_scan_interrupt_SRC := $(matrix_edge_scan_SRC)
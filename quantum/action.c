@@ -31,6 +31,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "keycode_config.h"
 #include "debug.h"
 #include "quantum.h"
+#include "profiling.h"
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -71,6 +75,7 @@ __attribute__((weak)) bool get_retro_tapping(uint16_t keycode, keyrecord_t *reco
  * FIXME: Needs documentation.
  */
 void action_exec(keyevent_t event) {
+    PROBE_BEGIN(PROFILING_PROBE_ACTION_EXEC);
     if (IS_EVENT(event)) {
         ac_dprintf("\n---- action_exec: start -----\n");
         ac_dprintf("EVENT: ");
@@ -132,6 +137,13 @@ void action_exec(keyevent_t event) {
         dprintln();
     }
 #endif
+
+#ifdef PROFILING_ENABLE
+    // Ticks only advance timers, only time real events
+    if (IS_EVENT(event)) {
+        PROBE_END(PROFILING_PROBE_ACTION_EXEC);
+    }
+#endif
 }
 
 #ifdef SWAP_HANDS_ENABLE
@@ -271,17 +283,27 @@ void process_record(keyrecord_t *record) {
         return;
     }
 
+#ifdef LATENCY_TRACE_ENABLE
+    const uint8_t latency_trace = latency_trace_dispatch(record->event);
+#endif
+
     if (!process_record_quantum(record)) {
 #ifndef NO_ACTION_ONESHOT
         if (is_oneshot_layer_active() && record->event.pressed && keymap_config.oneshot_enable) {
             clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
         }
+#endif
+#ifdef LATENCY_TRACE_ENABLE
+        latency_trace_settle(latency_trace);
 #endif
         return;
     }
 
     process_record_handler(record);
     post_process_record_quantum(record);
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_settle(latency_trace);
+#endif
 }
 
 void process_record_handler(keyrecord_t *record) {
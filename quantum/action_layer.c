@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
@@ -220,10 +221,41 @@ void layer_debug(void) {
 /** \brief source layer cache
  */
 
+#    ifdef SOURCE_LAYERS_CACHE_PACKED
+uint8_t source_layers_cache[SOURCE_LAYERS_CACHE_BYTES(MATRIX_ROWS * MATRIX_COLS)] = {0};
+#        ifdef ENCODER_MAP_ENABLE
+uint8_t encoder_source_layers_cache[SOURCE_LAYERS_CACHE_BYTES(NUM_ENCODERS)] = {0};
+#        endif // ENCODER_MAP_ENABLE
+
+/** \brief update source layers cache impl
+ *
+ * Updates the supplied cache when changing layers, each entry is packed in its own nibble or byte
+ */
+void update_source_layers_cache_impl(uint8_t layer, uint16_t entry_number, uint8_t cache[]) {
+#        if SOURCE_LAYERS_CACHE_ENTRY_BITS == 4
+    const uint8_t shift = (entry_number & 1) * 4;
+    cache[entry_number / 2] = (cache[entry_number / 2] & ~(0x0F << shift)) | ((layer & 0x0F) << shift);
+#        else
+    cache[entry_number] = layer;
+#        endif
+}
+
+/** \brief read source layers cache
+ *
+ * reads the cached keys stored when the layer was changed
+ */
+uint8_t read_source_layers_cache_impl(uint16_t entry_number, uint8_t cache[]) {
+#        if SOURCE_LAYERS_CACHE_ENTRY_BITS == 4
+    return (cache[entry_number / 2] >> ((entry_number & 1) * 4)) & 0x0F;
+#        else
+    return cache[entry_number];
+#        endif
+}
+#    else
 uint8_t source_layers_cache[((MATRIX_ROWS * MATRIX_COLS) + (CHAR_BIT)-1) / (CHAR_BIT)][MAX_LAYER_BITS] = {{0}};
-#    ifdef ENCODER_MAP_ENABLE
+#        ifdef ENCODER_MAP_ENABLE
 uint8_t encoder_source_layers_cache[(NUM_ENCODERS + (CHAR_BIT)-1) / (CHAR_BIT)][MAX_LAYER_BITS] = {{0}};
-#    endif // ENCODER_MAP_ENABLE
+#        endif // ENCODER_MAP_ENABLE
 
 /** \brief update source layers cache impl
  *
@@ -252,6 +284,7 @@ uint8_t read_source_layers_cache_impl(uint16_t entry_number, uint8_t cache[][MAX
 
     return layer;
 }
+#    endif // SOURCE_LAYERS_CACHE_PACKED
 
 /** \brief update encoder source layers cache
  *
@@ -316,16 +349,15 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
-/** \brief Layer switch get layer
+#ifndef NO_ACTION_LAYER
+/** \brief Resolve layer
  *
- * Gets the layer based on key info
+ * Walks the active layers from the top and returns the first one where the key is not transparent
  */
-uint8_t layer_switch_get_layer(keypos_t key) {
-#ifndef NO_ACTION_LAYER
+static uint8_t layer_switch_resolve_layer(layer_state_t layers, keypos_t key) {
     action_t action;
     action.code = ACTION_TRANSPARENT;
 
-    layer_state_t layers = layer_state | default_layer_state;
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
@@ -337,6 +369,85 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     }
     /* fall back to layer 0 */
     return 0;
+}
+
+#    ifdef LAYER_RESOLUTION_CACHE
+#        ifndef LAYER_RESOLUTION_CACHE_SLOTS
+#            define LAYER_RESOLUTION_CACHE_SLOTS 2
+#        endif
+#        define LAYER_RESOLUTION_UNKNOWN 0xFF
+
+/* Resolved layer per key, for the most recently used layer state combinations */
+typedef struct {
+    layer_state_t layers;
+    uint8_t       age;
+    bool          valid;
+    uint8_t       layer[MATRIX_ROWS][MATRIX_COLS];
+} layer_resolution_t;
+
+static layer_resolution_t layer_resolution_cache[LAYER_RESOLUTION_CACHE_SLOTS];
+
+/** \brief Layer resolution cache invalidate
+ *
+ * Forgets every resolved key, needed whenever the contents of the keymap change
+ */
+void layer_resolution_cache_invalidate(void) {
+    for (uint8_t i = 0; i < LAYER_RESOLUTION_CACHE_SLOTS; i++) {
+        layer_resolution_cache[i].valid = false;
+    }
+}
+
+static layer_resolution_t *layer_resolution_cache_get(layer_state_t layers) {
+    uint8_t slot = LAYER_RESOLUTION_CACHE_SLOTS;
+    uint8_t lru  = 0;
+
+    for (uint8_t i = 0; i < LAYER_RESOLUTION_CACHE_SLOTS; i++) {
+        if (layer_resolution_cache[i].valid && layer_resolution_cache[i].layers == layers) {
+            slot = i;
+            break;
+        }
+        if (!layer_resolution_cache[i].valid || (layer_resolution_cache[lru].valid && layer_resolution_cache[i].age > layer_resolution_cache[lru].age)) {
+            lru = i;
+        }
+    }
+
+    if (slot == LAYER_RESOLUTION_CACHE_SLOTS) {
+        // First time this combination is seen, replace an empty or the least recently used slot
+        slot                                = lru;
+        layer_resolution_cache[slot].layers = layers;
+        layer_resolution_cache[slot].valid  = true;
+        memset(layer_resolution_cache[slot].layer, LAYER_RESOLUTION_UNKNOWN, sizeof(layer_resolution_cache[slot].layer));
+    }
+
+    for (uint8_t i = 0; i < LAYER_RESOLUTION_CACHE_SLOTS; i++) {
+        if (layer_resolution_cache[i].age < UINT8_MAX) {
+            layer_resolution_cache[i].age++;
+        }
+    }
+    layer_resolution_cache[slot].age = 0;
+    return &layer_resolution_cache[slot];
+}
+#    endif
+#endif
+
+/** \brief Layer switch get layer
+ *
+ * Gets the layer based on key info
+ */
+uint8_t layer_switch_get_layer(keypos_t key) {
+#ifndef NO_ACTION_LAYER
+    layer_state_t layers = layer_state | default_layer_state;
+#    ifdef LAYER_RESOLUTION_CACHE
+    // Encoders and combos use positions outside the matrix, resolve those directly
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        uint8_t *layer = &layer_resolution_cache_get(layers)->layer[key.row][key.col];
+        if (*layer == LAYER_RESOLUTION_UNKNOWN) {
+            *layer = layer_switch_resolve_layer(layers, key);
+        }
+        return *layer;
+    }
+#    endif
+    return layer_switch_resolve_layer(layers, key);
 #else
     return get_highest_layer(default_layer_state);
 #endif
@@ -157,6 +157,18 @@ layer_state_t update_tri_layer_state(layer_state_t state, uint8_t layer1, uint8_
 
 /* pressed actions cache */
 #if !defined(NO_ACTION_LAYER) && !defined(STRICT_LAYER_RELEASE)
+#    ifdef SOURCE_LAYERS_CACHE_PACKED
+/* one nibble or byte per key, whichever holds a layer number */
+#        if MAX_LAYER_BITS <= 4
+#            define SOURCE_LAYERS_CACHE_ENTRY_BITS 4
+#        else
+#            define SOURCE_LAYERS_CACHE_ENTRY_BITS 8
+#        endif
+#        define SOURCE_LAYERS_CACHE_BYTES(entries) (((entries) * SOURCE_LAYERS_CACHE_ENTRY_BITS + 7) / 8)
+#    else
+/* one bit per key in each of MAX_LAYER_BITS planes */
+#        define SOURCE_LAYERS_CACHE_BYTES(entries) ((((entries) + 7) / 8) * MAX_LAYER_BITS)
+#    endif
 
 void    update_source_layers_cache(keypos_t key, uint8_t layer);
 uint8_t read_source_layers_cache(keypos_t key);
@@ -166,5 +178,10 @@ action_t store_or_get_action(bool pressed, keypos_t key);
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_RESOLUTION_CACHE)
+/* forget the layers resolved by layer_switch_get_layer, call after changing the keymap */
+void layer_resolution_cache_invalidate(void);
+#endif
+
 /* return action depending on current layer status */
 action_t layer_switch_get_action(keypos_t key);
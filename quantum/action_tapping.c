@@ -1,11 +1,15 @@
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "action.h"
 #include "action_layer.h"
 #include "action_tapping.h"
 #include "keycode.h"
 #include "timer.h"
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
 
 #ifndef NO_ACTION_TAPPING
 
@@ -64,9 +68,29 @@ static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
 static uint8_t     waiting_buffer_head                 = 0;
 static uint8_t     waiting_buffer_tail                 = 0;
 
+#    ifdef WAITING_BUFFER_INDEX
+/* Pending presses and releases of every matrix key in the waiting buffer,
+ * packed as two counters per key, so lookups don't have to walk the ring. */
+#        if WAITING_BUFFER_SIZE <= 16
+typedef uint8_t waiting_buffer_pending_t;
+#            define WAITING_BUFFER_RELEASE_SHIFT 4
+#        else
+typedef uint16_t waiting_buffer_pending_t;
+#            define WAITING_BUFFER_RELEASE_SHIFT 8
+#        endif
+#        define WAITING_BUFFER_PENDING_MASK ((1 << WAITING_BUFFER_RELEASE_SHIFT) - 1)
+
+static waiting_buffer_pending_t waiting_buffer_pending[MATRIX_ROWS * MATRIX_COLS] = {};
+static uint8_t                  waiting_buffer_presses                           = 0;
+// records of keys outside the matrix (encoders, combos, ...), these are still scanned for
+static uint8_t waiting_buffer_unindexed = 0;
+#    endif
+
 static bool process_tapping(keyrecord_t *record);
 static bool waiting_buffer_enq(keyrecord_t record);
+static void waiting_buffer_deq(void);
 static void waiting_buffer_clear(void);
+static void waiting_buffer_flush(keyrecord_t record);
 static bool waiting_buffer_typed(keyevent_t event);
 static bool waiting_buffer_has_anykey_pressed(void);
 static void waiting_buffer_scan_tap(void);
@@ -86,11 +110,7 @@ void action_tapping_process(keyrecord_t record) {
         }
     } else {
         if (!waiting_buffer_enq(record)) {
-            // clear all in case of overflow.
-            ac_dprintf("OVERFLOW: CLEAR ALL STATES\n");
-            clear_keyboard();
-            waiting_buffer_clear();
-            tapping_key = (keyrecord_t){0};
+            waiting_buffer_flush(record);
         }
     }
 
@@ -98,11 +118,12 @@ void action_tapping_process(keyrecord_t record) {
     if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    while (waiting_buffer_tail != waiting_buffer_head) {
         if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
             ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
             debug_record(waiting_buffer[waiting_buffer_tail]);
             ac_dprintf("\n\n");
+            waiting_buffer_deq();
         } else {
             break;
         }
@@ -176,6 +197,9 @@ bool process_tapping(keyrecord_t *keyp) {
             // into the "pressed" tapping key state
             ac_dprintf("Tapping: Start(Press tap key).\n");
             tapping_key = *keyp;
+#    ifdef LATENCY_TRACE_ENABLE
+            latency_trace_hold(keyp->event, LATENCY_TRACE_TAPPING);
+#    endif
             process_record_tap_hint(&tapping_key);
             waiting_buffer_scan_tap();
             debug_tapping_key();
@@ -432,6 +456,31 @@ bool process_tapping(keyrecord_t *keyp) {
     }
 }
 
+#    ifdef WAITING_BUFFER_INDEX
+static inline bool waiting_buffer_indexed(keypos_t key) {
+    return key.row < MATRIX_ROWS && key.col < MATRIX_COLS;
+}
+
+/** \brief Count a record entering (+1) or leaving (-1) the waiting buffer
+ */
+static void waiting_buffer_index(keyevent_t event, int8_t delta) {
+    if (!waiting_buffer_indexed(event.key)) {
+        waiting_buffer_unindexed += delta;
+        return;
+    }
+    waiting_buffer_pending[event.key.row * MATRIX_COLS + event.key.col] += (waiting_buffer_pending_t)(delta * (1 << (event.pressed ? 0 : WAITING_BUFFER_RELEASE_SHIFT)));
+    if (event.pressed) {
+        waiting_buffer_presses += delta;
+    }
+}
+
+/** \brief Number of buffered presses (or releases) of a matrix key
+ */
+static uint8_t waiting_buffer_pending_count(keypos_t key, bool pressed) {
+    return (waiting_buffer_pending[key.row * MATRIX_COLS + key.col] >> (pressed ? 0 : WAITING_BUFFER_RELEASE_SHIFT)) & WAITING_BUFFER_PENDING_MASK;
+}
+#    endif
+
 /** \brief Waiting buffer enq
  *
  * FIXME: Needs docs
@@ -448,6 +497,12 @@ bool waiting_buffer_enq(keyrecord_t record) {
 
     waiting_buffer[waiting_buffer_head] = record;
     waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
+#    ifdef WAITING_BUFFER_INDEX
+    waiting_buffer_index(record.event, 1);
+#    endif
+#    ifdef LATENCY_TRACE_ENABLE
+    latency_trace_hold(record.event, LATENCY_TRACE_TAPPING);
+#    endif
 
     ac_dprintf("waiting_buffer_enq: ");
     debug_waiting_buffer();
@@ -461,6 +516,50 @@ bool waiting_buffer_enq(keyrecord_t record) {
 void waiting_buffer_clear(void) {
     waiting_buffer_head = 0;
     waiting_buffer_tail = 0;
+#    ifdef WAITING_BUFFER_INDEX
+    memset(waiting_buffer_pending, 0, sizeof(waiting_buffer_pending));
+    waiting_buffer_presses   = 0;
+    waiting_buffer_unindexed = 0;
+#    endif
+}
+
+/** \brief Waiting buffer deq
+ *
+ * Drops the oldest record once it has been processed.
+ */
+void waiting_buffer_deq(void) {
+#    ifdef WAITING_BUFFER_INDEX
+    waiting_buffer_index(waiting_buffer[waiting_buffer_tail].event, -1);
+#    endif
+    waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+}
+
+/** \brief Waiting buffer flush
+ *
+ * Makes room for a record that overflowed the waiting buffer. An undecided
+ * tap-hold key is settled as held, as if its tapping term had expired, and the
+ * buffered records are replayed so that no key event is lost. Only a tap that
+ * is still pressed cannot be settled early, in which case all state is cleared.
+ */
+void waiting_buffer_flush(keyrecord_t record) {
+    if (tapping_key.event.pressed && tapping_key.tap.count > 0) {
+        ac_dprintf("OVERFLOW: CLEAR ALL STATES\n");
+        clear_keyboard();
+        waiting_buffer_clear();
+        tapping_key = (keyrecord_t){0};
+        return;
+    }
+
+    ac_dprintf("OVERFLOW: FLUSH\n");
+    if (tapping_key.event.pressed) {
+        process_record(&tapping_key);
+    }
+    tapping_key = (keyrecord_t){0};
+    while (waiting_buffer_tail != waiting_buffer_head && process_tapping(&waiting_buffer[waiting_buffer_tail])) {
+        waiting_buffer_deq();
+    }
+    // with no tapping key the oldest record is always processed, so there is room now
+    waiting_buffer_enq(record);
 }
 
 /** \brief Waiting buffer typed
@@ -468,6 +567,14 @@ void waiting_buffer_clear(void) {
  * FIXME: Needs docs
  */
 bool waiting_buffer_typed(keyevent_t event) {
+#    ifdef WAITING_BUFFER_INDEX
+    if (waiting_buffer_indexed(event.key)) {
+        return waiting_buffer_pending_count(event.key, !event.pressed) > 0;
+    }
+    if (waiting_buffer_unindexed == 0) {
+        return false;
+    }
+#    endif
     for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
         if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed != waiting_buffer[i].event.pressed) {
             return true;
@@ -481,6 +588,14 @@ bool waiting_buffer_typed(keyevent_t event) {
  * FIXME: Needs docs
  */
 __attribute__((unused)) bool waiting_buffer_has_anykey_pressed(void) {
+#    ifdef WAITING_BUFFER_INDEX
+    if (waiting_buffer_presses > 0) {
+        return true;
+    }
+    if (waiting_buffer_unindexed == 0) {
+        return false;
+    }
+#    endif
     for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
         if (waiting_buffer[i].event.pressed) return true;
     }
@@ -499,6 +614,13 @@ void waiting_buffer_scan_tap(void) {
         return;
     }
 
+#    ifdef WAITING_BUFFER_INDEX
+    // nothing to scan for unless a release of the tapping key is buffered
+    if (waiting_buffer_indexed(tapping_key.event.key) ? waiting_buffer_pending_count(tapping_key.event.key, false) == 0 : waiting_buffer_unindexed == 0) {
+        return;
+    }
+#    endif
+
 #    if (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
     TAP_DEFINE_KEYCODE;
 #    endif
@@ -19,23 +19,31 @@
         PROFILE_CALL_NAMED(1000, "matrix_task", {
             matrix_task();
         });
+
+    With PROFILING_ENABLE = yes the calls are timed by the probes in "profiling.h"
+    instead, the sample count is then unused.
 */
 
-#if defined(PROTOCOL_LUFA) || defined(PROTOCOL_VUSB)
-#    define TIMESTAMP_GETTER TCNT0
-#elif defined(PROTOCOL_CHIBIOS)
-#    define TIMESTAMP_GETTER chSysGetRealtimeCounterX()
+#ifdef PROFILING_ENABLE
+#    include "profiling.h"
+
+#    define PROFILE_CALL_NAMED(count, name, call) PROBE_CALL(name, call)
 #else
-#    error Unknown protocol in use
-#endif
+#    if defined(PROTOCOL_LUFA) || defined(PROTOCOL_VUSB)
+#        define TIMESTAMP_GETTER TCNT0
+#    elif defined(PROTOCOL_CHIBIOS)
+#        define TIMESTAMP_GETTER chSysGetRealtimeCounterX()
+#    else
+#        error Unknown protocol in use
+#    endif
 
-#ifndef CONSOLE_ENABLE
+#    ifndef CONSOLE_ENABLE
 // Can't do anything if we don't have console output enabled.
-#    define PROFILE_CALL_NAMED(count, name, call) \
-        do {                                      \
+#        define PROFILE_CALL_NAMED(count, name, call) \
+        do {                                          \
         } while (0)
-#else
-#    define PROFILE_CALL_NAMED(count, name, call)                                                                         \
+#    else
+#        define PROFILE_CALL_NAMED(count, name, call)                                                                     \
         do {                                                                                                              \
             static uint64_t inner_sum = 0;                                                                                \
             static uint64_t outer_sum = 0;                                                                                \
@@ -62,6 +70,7 @@
             }                                                                                                             \
         } while (0)
 
-#endif // CONSOLE_ENABLE
+#    endif // CONSOLE_ENABLE
+#endif
 
 #define PROFILE_CALL(count, call) PROFILE_CALL_NAMED(count, #call, call)
@@ -108,3 +108,13 @@ rgb_t hsv_to_rgb(hsv_t hsv) {
 rgb_t hsv_to_rgb_nocie(hsv_t hsv) {
     return hsv_to_rgb_impl(hsv, false);
 }
+
+/*
+ * Converts `count` colors in one call, `hsv` and `rgb` may point to the same
+ * buffer.
+ */
+void hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        rgb[i] = hsv_to_rgb(hsv[i]);
+    }
+}
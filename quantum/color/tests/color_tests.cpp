@@ -0,0 +1,141 @@
+/* Copyright 2024 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+#include "led_tables.h"
+#include "progmem.h"
+}
+
+// The switch based conversion that hsv_to_rgb() and hsv_to_rgb_batch() must match
+static rgb_t reference_hsv_to_rgb(hsv_t hsv, bool use_cie) {
+    rgb_t    rgb;
+    uint8_t  region, remainder, p, q, t;
+    uint16_t h, s, v;
+
+    v = hsv.v;
+#ifdef USE_CIE1931_CURVE
+    if (use_cie) {
+        v = pgm_read_byte(&CIE1931_CURVE[hsv.v]);
+    }
+#endif
+
+    if (hsv.s == 0) {
+        rgb.r = rgb.g = rgb.b = v;
+        return rgb;
+    }
+
+    h = hsv.h;
+    s = hsv.s;
+
+    region    = h * 6 / 255;
+    remainder = (h * 2 - region * 85) * 3;
+
+    p = (v * (255 - s)) >> 8;
+    q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+    switch (region) {
+        case 6:
+        case 0:
+            rgb.r = v;
+            rgb.g = t;
+            rgb.b = p;
+            break;
+        case 1:
+            rgb.r = q;
+            rgb.g = v;
+            rgb.b = p;
+            break;
+        case 2:
+            rgb.r = p;
+            rgb.g = v;
+            rgb.b = t;
+            break;
+        case 3:
+            rgb.r = p;
+            rgb.g = q;
+            rgb.b = v;
+            break;
+        case 4:
+            rgb.r = t;
+            rgb.g = p;
+            rgb.b = v;
+            break;
+        default:
+            rgb.r = v;
+            rgb.g = p;
+            rgb.b = q;
+            break;
+    }
+
+    return rgb;
+}
+
+static bool operator==(const rgb_t &a, const rgb_t &b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b;
+}
+
+static std::ostream &operator<<(std::ostream &os, const hsv_t &hsv) {
+    return os << "hsv(" << +hsv.h << ", " << +hsv.s << ", " << +hsv.v << ")";
+}
+
+class Color : public ::testing::Test {};
+
+TEST_F(Color, HsvToRgbMatchesReference) {
+    for (uint32_t i = 0; i < 1 << 24; i++) {
+        hsv_t hsv = {(uint8_t)(i >> 16), (uint8_t)(i >> 8), (uint8_t)i};
+        ASSERT_TRUE(hsv_to_rgb(hsv) == reference_hsv_to_rgb(hsv, true)) << hsv;
+        ASSERT_TRUE(hsv_to_rgb_nocie(hsv) == reference_hsv_to_rgb(hsv, false)) << hsv;
+    }
+}
+
+TEST_F(Color, HsvToRgbBatchMatchesReference) {
+    hsv_t hsv[256];
+    rgb_t rgb[256];
+
+    for (uint16_t h = 0; h < 256; h++) {
+        for (uint16_t s = 0; s < 256; s++) {
+            for (uint16_t v = 0; v < 256; v++) {
+                hsv[v] = {(uint8_t)h, (uint8_t)s, (uint8_t)v};
+            }
+            // A count of 255 leaves the last color out, covering the full range needs two calls
+            hsv_to_rgb_batch(hsv, rgb, 128);
+            hsv_to_rgb_batch(hsv + 128, rgb + 128, 128);
+            for (uint16_t v = 0; v < 256; v++) {
+                ASSERT_TRUE(rgb[v] == reference_hsv_to_rgb(hsv[v], true)) << hsv[v];
+            }
+        }
+    }
+}
+
+TEST_F(Color, HsvToRgbBatchConvertsInPlace) {
+    union {
+        hsv_t hsv[64];
+        rgb_t rgb[64];
+    } buffer;
+    hsv_t hsv[64];
+
+    for (uint8_t i = 0; i < 64; i++) {
+        hsv[i] = buffer.hsv[i] = {(uint8_t)(i * 4), (uint8_t)(255 - i), (uint8_t)(i * 3 + 50)};
+    }
+    hsv_to_rgb_batch(buffer.hsv, buffer.rgb, 64);
+    for (uint8_t i = 0; i < 64; i++) {
+        EXPECT_TRUE(buffer.rgb[i] == reference_hsv_to_rgb(hsv[i], true)) << hsv[i];
+    }
+}
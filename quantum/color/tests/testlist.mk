@@ -0,0 +1,3 @@
+TEST_LIST += \
+	color \
+	color_cie1931
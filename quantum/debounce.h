@@ -4,6 +4,37 @@
 #include <stdbool.h>
 #include "matrix.h"
 
+/**
+ * @brief Upper bound of num_rows passed to the debounce API, used to size
+ * the storage of algorithms built with DEBOUNCE_STATIC_ALLOCATION.
+ */
+#ifndef DEBOUNCE_MAX_ROWS
+#    ifdef SPLIT_KEYBOARD
+#        define DEBOUNCE_MAX_ROWS (MATRIX_ROWS / 2)
+#    else
+#        define DEBOUNCE_MAX_ROWS MATRIX_ROWS
+#    endif
+#endif
+
+/**
+ * @brief Limits num_rows to DEBOUNCE_MAX_ROWS, so that a caller passing more
+ * rows than the static storage holds cannot overrun it.
+ */
+#define DEBOUNCE_CLAMP_ROWS(num_rows) ((num_rows) > DEBOUNCE_MAX_ROWS ? DEBOUNCE_MAX_ROWS : (num_rows))
+
+/**
+ * @brief DEBOUNCE_CLAMP_ROWS for debounce_init(), which also reports on the
+ * debug console that the rows beyond DEBOUNCE_MAX_ROWS will not be debounced.
+ * Needs "debug.h".
+ */
+#define DEBOUNCE_INIT_ROWS(num_rows)                                                                                           \
+    do {                                                                                                                       \
+        if ((num_rows) > DEBOUNCE_MAX_ROWS) {                                                                                  \
+            dprintf("debounce: %d rows but DEBOUNCE_MAX_ROWS is %d, define it in config.h\n", (num_rows), DEBOUNCE_MAX_ROWS); \
+            (num_rows) = DEBOUNCE_MAX_ROWS;                                                                                    \
+        }                                                                                                                      \
+    } while (0)
+
 /**
  * @brief Debounce raw matrix events according to the choosen debounce algorithm.
  *
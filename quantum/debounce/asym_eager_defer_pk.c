@@ -24,12 +24,15 @@ releasing a key, that state is pushed after no changes occur for DEBOUNCE millis
 */
 
 #include "debounce.h"
+#include "debug.h"
 #include "timer.h"
-#include <stdlib.h>
+#ifndef DEBOUNCE_STATIC_ALLOCATION
+#    include <stdlib.h>
 
-#ifdef PROTOCOL_CHIBIOS
-#    if CH_CFG_USE_MEMCORE == FALSE
-#        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
+#    ifdef PROTOCOL_CHIBIOS
+#        if CH_CFG_USE_MEMCORE == FALSE
+#            error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm unless `DEBOUNCE_STATIC_ALLOCATION` is defined.
+#        endif
 #    endif
 #endif
 
@@ -51,7 +54,11 @@ typedef struct {
 } debounce_counter_t;
 
 #if DEBOUNCE > 0
+#    ifdef DEBOUNCE_STATIC_ALLOCATION
+static debounce_counter_t debounce_counters[DEBOUNCE_MAX_ROWS * MATRIX_COLS];
+#    else
 static debounce_counter_t *debounce_counters;
+#    endif
 static fast_timer_t        last_time;
 static bool                counters_need_update;
 static bool                matrix_need_update;
@@ -64,8 +71,12 @@ static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], ui
 
 // we use num_rows rather than MATRIX_ROWS to support split keyboards
 void debounce_init(uint8_t num_rows) {
+#    ifdef DEBOUNCE_STATIC_ALLOCATION
+    DEBOUNCE_INIT_ROWS(num_rows);
+#    else
     debounce_counters = malloc(num_rows * MATRIX_COLS * sizeof(debounce_counter_t));
-    int i             = 0;
+#    endif
+    int i = 0;
     for (uint8_t r = 0; r < num_rows; r++) {
         for (uint8_t c = 0; c < MATRIX_COLS; c++) {
             debounce_counters[i++].time = DEBOUNCE_ELAPSED;
@@ -74,11 +85,16 @@ void debounce_init(uint8_t num_rows) {
 }
 
 void debounce_free(void) {
+#    ifndef DEBOUNCE_STATIC_ALLOCATION
     free(debounce_counters);
     debounce_counters = NULL;
+#    endif
 }
 
 bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+#    ifdef DEBOUNCE_STATIC_ALLOCATION
+    num_rows = DEBOUNCE_CLAMP_ROWS(num_rows);
+#    endif
     bool updated_last = false;
     cooked_changed    = false;
 
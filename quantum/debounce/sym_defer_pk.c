@@ -20,12 +20,15 @@ When no state changes have occured for DEBOUNCE milliseconds, we push the state.
 */
 
 #include "debounce.h"
+#include "debug.h"
 #include "timer.h"
-#include <stdlib.h>
+#ifndef DEBOUNCE_STATIC_ALLOCATION
+#    include <stdlib.h>
 
-#ifdef PROTOCOL_CHIBIOS
-#    if CH_CFG_USE_MEMCORE == FALSE
-#        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
+#    ifdef PROTOCOL_CHIBIOS
+#        if CH_CFG_USE_MEMCORE == FALSE
+#            error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm unless `DEBOUNCE_STATIC_ALLOCATION` is defined.
+#        endif
 #    endif
 #endif
 
@@ -44,7 +47,11 @@ When no state changes have occured for DEBOUNCE milliseconds, we push the state.
 typedef uint8_t debounce_counter_t;
 
 #if DEBOUNCE > 0
+#    ifdef DEBOUNCE_STATIC_ALLOCATION
+static debounce_counter_t debounce_counters[DEBOUNCE_MAX_ROWS * MATRIX_COLS];
+#    else
 static debounce_counter_t *debounce_counters;
+#    endif
 static fast_timer_t        last_time;
 static bool                counters_need_update;
 static bool                cooked_changed;
@@ -56,8 +63,12 @@ static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], u
 
 // we use num_rows rather than MATRIX_ROWS to support split keyboards
 void debounce_init(uint8_t num_rows) {
+#    ifdef DEBOUNCE_STATIC_ALLOCATION
+    DEBOUNCE_INIT_ROWS(num_rows);
+#    else
     debounce_counters = (debounce_counter_t *)malloc(num_rows * MATRIX_COLS * sizeof(debounce_counter_t));
-    int i             = 0;
+#    endif
+    int i = 0;
     for (uint8_t r = 0; r < num_rows; r++) {
         for (uint8_t c = 0; c < MATRIX_COLS; c++) {
             debounce_counters[i++] = DEBOUNCE_ELAPSED;
@@ -66,11 +77,16 @@ void debounce_init(uint8_t num_rows) {
 }
 
 void debounce_free(void) {
+#    ifndef DEBOUNCE_STATIC_ALLOCATION
     free(debounce_counters);
     debounce_counters = NULL;
+#    endif
 }
 
 bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+#    ifdef DEBOUNCE_STATIC_ALLOCATION
+    num_rows = DEBOUNCE_CLAMP_ROWS(num_rows);
+#    endif
     bool updated_last = false;
     cooked_changed    = false;
 
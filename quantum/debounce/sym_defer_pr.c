@@ -18,34 +18,57 @@ DEBOUNCE milliseconds have elapsed since the last change.
 */
 
 #include "debounce.h"
+#include "debug.h"
 #include "timer.h"
-#include <stdlib.h>
+#ifdef DEBOUNCE_STATIC_ALLOCATION
+#    include <string.h>
+#else
+#    include <stdlib.h>
+#endif
 
 #ifndef DEBOUNCE
 #    define DEBOUNCE 5
 #endif
 
 static uint16_t last_time;
+#ifdef DEBOUNCE_STATIC_ALLOCATION
+// [row] milliseconds until key's state is considered debounced.
+static uint8_t countdowns[DEBOUNCE_MAX_ROWS];
+// [row]
+static matrix_row_t last_raw[DEBOUNCE_MAX_ROWS];
+#else
 // [row] milliseconds until key's state is considered debounced.
 static uint8_t* countdowns;
 // [row]
 static matrix_row_t* last_raw;
+#endif
 
 void debounce_init(uint8_t num_rows) {
+#ifdef DEBOUNCE_STATIC_ALLOCATION
+    DEBOUNCE_INIT_ROWS(num_rows);
+    memset(countdowns, 0, sizeof(countdowns));
+    memset(last_raw, 0, sizeof(last_raw));
+#else
     countdowns = (uint8_t*)calloc(num_rows, sizeof(uint8_t));
     last_raw   = (matrix_row_t*)calloc(num_rows, sizeof(matrix_row_t));
+#endif
 
     last_time = timer_read();
 }
 
 void debounce_free(void) {
+#ifndef DEBOUNCE_STATIC_ALLOCATION
     free(countdowns);
     countdowns = NULL;
     free(last_raw);
     last_raw = NULL;
+#endif
 }
 
 bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+#ifdef DEBOUNCE_STATIC_ALLOCATION
+    num_rows = DEBOUNCE_CLAMP_ROWS(num_rows);
+#endif
     uint16_t now           = timer_read();
     uint16_t elapsed16     = TIMER_DIFF_16(now, last_time);
     last_time              = now;
@@ -0,0 +1,180 @@
+/*
+Copyright 2024 QMK
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Symmetric per-key algorithm with bit-sliced (vertical) counters.
+Behaves exactly like sym_defer_pk: when no state changes have occured for
+DEBOUNCE milliseconds on a key, we push the state of that key.
+
+Instead of one byte per key, bit n of every counter in a row is stored in
+counter_planes[row][n], so a whole row is started, decremented and expired
+with a handful of bitwise operations per counter bit.
+*/
+
+#include "debounce.h"
+#include "debug.h"
+#include "timer.h"
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+#if DEBOUNCE > 0
+
+// Number of counter bits needed to hold DEBOUNCE
+#    if DEBOUNCE < 2
+#        define DEBOUNCE_PLANES 1
+#    elif DEBOUNCE < 4
+#        define DEBOUNCE_PLANES 2
+#    elif DEBOUNCE < 8
+#        define DEBOUNCE_PLANES 3
+#    elif DEBOUNCE < 16
+#        define DEBOUNCE_PLANES 4
+#    elif DEBOUNCE < 32
+#        define DEBOUNCE_PLANES 5
+#    elif DEBOUNCE < 64
+#        define DEBOUNCE_PLANES 6
+#    elif DEBOUNCE < 128
+#        define DEBOUNCE_PLANES 7
+#    else
+#        define DEBOUNCE_PLANES 8
+#    endif
+
+#    define PLANE_MASK(value, plane) (((value) >> (plane)) & 1 ? (matrix_row_t)~0 : (matrix_row_t)0)
+
+static matrix_row_t counter_planes[DEBOUNCE_MAX_ROWS][DEBOUNCE_PLANES];
+static fast_timer_t last_time;
+static bool         counters_need_update;
+static bool         cooked_changed;
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    DEBOUNCE_INIT_ROWS(num_rows);
+    for (uint8_t row = 0; row < num_rows; row++) {
+        for (uint8_t plane = 0; plane < DEBOUNCE_PLANES; plane++) {
+            counter_planes[row][plane] = 0;
+        }
+    }
+    counters_need_update = false;
+}
+
+void debounce_free(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    num_rows = DEBOUNCE_CLAMP_ROWS(num_rows);
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        // No counter is ever above DEBOUNCE, so anything longer expires all of them alike
+        if (elapsed_time > DEBOUNCE) {
+            elapsed_time = DEBOUNCE;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+        }
+    }
+
+    if (changed) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_debounce_counters(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t *planes = counter_planes[row];
+        matrix_row_t  active = 0;
+        for (uint8_t plane = 0; plane < DEBOUNCE_PLANES; plane++) {
+            active |= planes[plane];
+        }
+        if (!active) {
+            continue;
+        }
+
+        // Ripple-borrow subtraction of elapsed_time from every counter in the row at once
+        matrix_row_t borrow    = 0;
+        matrix_row_t remaining = 0;
+        for (uint8_t plane = 0; plane < DEBOUNCE_PLANES; plane++) {
+            matrix_row_t counter = planes[plane];
+            matrix_row_t elapsed = PLANE_MASK(elapsed_time, plane);
+
+            planes[plane] = (counter ^ elapsed ^ borrow) & active;
+            borrow        = (~counter & (elapsed | borrow)) | (counter & elapsed & borrow);
+            remaining |= planes[plane];
+        }
+
+        // Counters that reached zero or wrapped around have expired
+        matrix_row_t expired = active & (borrow | ~remaining);
+        if (expired) {
+            for (uint8_t plane = 0; plane < DEBOUNCE_PLANES; plane++) {
+                planes[plane] &= ~expired;
+            }
+
+            matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row] = cooked_next;
+        }
+
+        if (active & ~expired) {
+            counters_need_update = true;
+        }
+    }
+}
+
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t *planes = counter_planes[row];
+        matrix_row_t  delta  = raw[row] ^ cooked[row];
+        matrix_row_t  active = 0;
+        for (uint8_t plane = 0; plane < DEBOUNCE_PLANES; plane++) {
+            active |= planes[plane];
+        }
+
+        // Keys that changed and are not already counting start at DEBOUNCE, unchanged keys are reset
+        matrix_row_t start = delta & ~active;
+        for (uint8_t plane = 0; plane < DEBOUNCE_PLANES; plane++) {
+            planes[plane] = (planes[plane] & delta & ~start) | (PLANE_MASK(DEBOUNCE, plane) & start);
+        }
+
+        if (start) {
+            counters_need_update = true;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
@@ -31,7 +31,8 @@ debounce_sym_defer_g_SRC := $(DEBOUNCE_COMMON_SRC) \
 debounce_sym_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_sym_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_defer_pk.c \
-	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_sliced_pk_tests.cpp
 
 debounce_sym_defer_pr_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_sym_defer_pr_SRC := $(DEBOUNCE_COMMON_SRC) \
@@ -52,3 +53,25 @@ debounce_asym_eager_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_asym_eager_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/asym_eager_defer_pk_tests.cpp
+
+debounce_sym_defer_sliced_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_defer_sliced_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_sliced_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_sliced_pk_tests.cpp
+
+# Same algorithms and tests, built with fixed-size storage instead of malloc
+debounce_sym_defer_pk_static_DEFS := $(DEBOUNCE_COMMON_DEFS) -DDEBOUNCE_STATIC_ALLOCATION
+debounce_sym_defer_pk_static_SRC := $(debounce_sym_defer_pk_SRC)
+
+debounce_sym_defer_pr_static_DEFS := $(DEBOUNCE_COMMON_DEFS) -DDEBOUNCE_STATIC_ALLOCATION
+debounce_sym_defer_pr_static_SRC := $(debounce_sym_defer_pr_SRC)
+
+debounce_sym_eager_pk_static_DEFS := $(DEBOUNCE_COMMON_DEFS) -DDEBOUNCE_STATIC_ALLOCATION
+debounce_sym_eager_pk_static_SRC := $(debounce_sym_eager_pk_SRC)
+
+debounce_sym_eager_pr_static_DEFS := $(DEBOUNCE_COMMON_DEFS) -DDEBOUNCE_STATIC_ALLOCATION
+debounce_sym_eager_pr_static_SRC := $(debounce_sym_eager_pr_SRC)
+
+debounce_asym_eager_defer_pk_static_DEFS := $(DEBOUNCE_COMMON_DEFS) -DDEBOUNCE_STATIC_ALLOCATION
+debounce_asym_eager_defer_pk_static_SRC := $(debounce_asym_eager_defer_pk_SRC)
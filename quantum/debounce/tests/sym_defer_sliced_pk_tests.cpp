@@ -0,0 +1,78 @@
+/* Copyright 2024 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Shared by sym_defer_pk and sym_defer_sliced_pk, both must produce identical output timing */
+
+#include "gtest/gtest.h"
+
+#include "debounce_test_common.h"
+
+TEST_F(DebounceTest, StaggeredKeysSameRow) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{1, 0, DOWN}}, {}},
+        {1, {{1, 3, DOWN}}, {}},
+        {2, {{1, 9, DOWN}}, {}},
+        {4, {{1, 5, DOWN}}, {}},
+
+        {5, {}, {{1, 0, DOWN}}},
+        {6, {}, {{1, 3, DOWN}}},
+        {7, {}, {{1, 9, DOWN}}},
+        {9, {}, {{1, 5, DOWN}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, BouncingKeyNextToSettledKey) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{2, 4, DOWN}, {2, 5, DOWN}}, {}},
+        {1, {{2, 5, UP}}, {}},
+        {2, {{2, 5, DOWN}}, {}},
+
+        {5, {}, {{2, 4, DOWN}}},
+        {7, {}, {{2, 5, DOWN}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, StaggeredKeysAcrossRows) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 0, DOWN}, {3, 9, DOWN}}, {}},
+        {3, {{1, 1, DOWN}, {2, 2, DOWN}}, {}},
+
+        {5, {}, {{0, 0, DOWN}, {3, 9, DOWN}}},
+        {6, {{0, 0, UP}}, {}},
+        {8, {}, {{1, 1, DOWN}, {2, 2, DOWN}}},
+
+        {11, {}, {{0, 0, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, DelayedScanStaggeredKeys) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+        {3, {{0, 2, DOWN}}, {}},
+
+        /* Both counters expire in the same late scan */
+        {40, {}, {{0, 1, DOWN}, {0, 2, DOWN}}},
+    });
+    time_jumps_ = true;
+    runEvents();
+}
@@ -5,4 +5,10 @@ TEST_LIST += \
 	debounce_sym_defer_pr \
 	debounce_sym_eager_pk \
 	debounce_sym_eager_pr \
-	debounce_asym_eager_defer_pk
+	debounce_asym_eager_defer_pk \
+	debounce_sym_defer_sliced_pk \
+	debounce_sym_defer_pk_static \
+	debounce_sym_defer_pr_static \
+	debounce_sym_eager_pk_static \
+	debounce_sym_eager_pr_static \
+	debounce_asym_eager_defer_pk_static
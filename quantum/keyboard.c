@@ -143,6 +143,13 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef LAYER_LOCK_ENABLE
 #    include "layer_lock.h"
 #endif
+#include "profiling.h"
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+#ifdef MATRIX_TRACE_ENABLE
+#    include "matrix_trace.h"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -197,13 +204,24 @@ void set_activity_timestamps(uint32_t matrix_timestamp, uint32_t encoder_timesta
 static uint32_t matrix_timer           = 0;
 static uint32_t matrix_scan_count      = 0;
 static uint32_t last_matrix_scan_count = 0;
+#    if defined(MATRIX_EDGE_SCAN)
+static uint32_t matrix_full_scan_base       = 0;
+static uint32_t last_matrix_full_scan_count = 0;
+#    endif
 
 void matrix_scan_perf_task(void) {
     matrix_scan_count++;
 
     uint32_t timer_now = timer_read32();
     if (TIMER_DIFF_32(timer_now, matrix_timer) >= 1000) {
-#    if defined(CONSOLE_ENABLE)
+#    if defined(MATRIX_EDGE_SCAN)
+        uint32_t full_scans         = matrix_edge_scan_full_count();
+        last_matrix_full_scan_count = full_scans - matrix_full_scan_base;
+        matrix_full_scan_base       = full_scans;
+#        if defined(CONSOLE_ENABLE)
+        dprintf("matrix scan frequency: %lu, full scans: %lu, saved: %lu\n", matrix_scan_count, last_matrix_full_scan_count, matrix_scan_count - last_matrix_full_scan_count);
+#        endif
+#    elif defined(CONSOLE_ENABLE)
         dprintf("matrix scan frequency: %lu\n", matrix_scan_count);
 #    endif
         last_matrix_scan_count = matrix_scan_count;
@@ -215,19 +233,39 @@ void matrix_scan_perf_task(void) {
 uint32_t get_matrix_scan_rate(void) {
     return last_matrix_scan_count;
 }
+
+uint32_t get_matrix_full_scan_rate(void) {
+#    if defined(MATRIX_EDGE_SCAN)
+    return last_matrix_full_scan_count;
+#    else
+    return last_matrix_scan_count;
+#    endif
+}
 #else
 #    define matrix_scan_perf_task()
 #endif
 
+/**
+ * @brief Returns the column of the lowest set bit in a non-zero row bitmap.
+ */
+#if (MATRIX_COLS <= 16)
+#    define matrix_row_lowest_col(bits) ((uint8_t)__builtin_ctz(bits))
+#else
+#    define matrix_row_lowest_col(bits) ((uint8_t)__builtin_ctzl(bits))
+#endif
+
 #ifdef MATRIX_HAS_GHOST
 static matrix_row_t get_real_keys(uint8_t row, matrix_row_t rowdata) {
     matrix_row_t out = 0;
-    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-        // read each key in the row data and check if the keymap defines it as a real key
-        if (keycode_at_keymap_location(0, row, col) && (rowdata & (((matrix_row_t)1) << col))) {
-            // this creates new row data, if a key is defined in the keymap, it will be set here
-            out |= ((matrix_row_t)1) << col;
+    // only visit the keys that are actually down in the row data
+    while (rowdata) {
+        const uint8_t      col = matrix_row_lowest_col(rowdata);
+        const matrix_row_t bit = MATRIX_ROW_SHIFTER << col;
+        // check if the keymap defines it as a real key, if so it will be set in the new row data
+        if (keycode_at_keymap_location(0, row, col)) {
+            out |= bit;
         }
+        rowdata &= ~bit;
     }
     return out;
 }
@@ -374,8 +412,10 @@ __attribute__((weak)) void housekeeping_task_user(void) {}
  * Invokes hooks for executing code after QMK is done after each loop iteration.
  */
 void housekeeping_task(void) {
+    PROBE_BEGIN(PROFILING_PROBE_HOUSEKEEPING_TASK);
     housekeeping_task_kb();
     housekeeping_task_user();
+    PROBE_END(PROFILING_PROBE_HOUSEKEEPING_TASK);
 }
 
 /** \brief quantum_init
@@ -411,6 +451,9 @@ void quantum_init(void) {
 void keyboard_init(void) {
     timer_init();
     sync_timer_init();
+#ifdef PROFILING_ENABLE
+    profiling_init();
+#endif
 #ifdef VIA_ENABLE
     via_init();
 #endif
@@ -523,6 +566,33 @@ static inline void generate_tick_event(void) {
     }
 }
 
+/**
+ * @brief Set of keys whose state differs from the previously processed matrix.
+ *
+ * Built in a single word-at-a-time pass over every row, so the per-key work
+ * afterwards only visits the bits that actually changed.
+ */
+typedef struct {
+    matrix_row_t current[MATRIX_ROWS]; // matrix state at the time of collection
+    matrix_row_t changes[MATRIX_ROWS]; // set bits are keys that toggled since the previous state
+} matrix_change_set_t;
+
+/**
+ * @brief Fills the change set against the previous matrix state.
+ *
+ * @return true At least one key changed
+ * @return false The matrix is unchanged
+ */
+static bool matrix_change_set_collect(matrix_change_set_t *set, const matrix_row_t previous[]) {
+    matrix_row_t any = 0;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        set->current[row] = matrix_get_row(row);
+        set->changes[row] = set->current[row] ^ previous[row];
+        any |= set->changes[row];
+    }
+    return any != 0;
+}
+
 /**
  * @brief This task scans the keyboards matrix and processes any key presses
  * that occur.
@@ -537,12 +607,19 @@ static bool matrix_task(void) {
     }
 
     static matrix_row_t matrix_previous[MATRIX_ROWS];
+    matrix_change_set_t change_set;
 
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_scan_start();
+#endif
+
+#ifdef MATRIX_EDGE_SCAN
+    // The edge triggered scanner reports changes reliably, so idle loops skip the row comparison
+    const bool matrix_changed = matrix_scan() && matrix_change_set_collect(&change_set, matrix_previous);
+#else
     matrix_scan();
-    bool matrix_changed = false;
-    for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_changed; row++) {
-        matrix_changed |= matrix_previous[row] ^ matrix_get_row(row);
-    }
+    const bool matrix_changed = matrix_change_set_collect(&change_set, matrix_previous);
+#endif
 
     matrix_scan_perf_task();
 
@@ -559,25 +636,34 @@ static bool matrix_task(void) {
     const bool process_keypress = should_process_keypress();
 
     for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
-        const matrix_row_t current_row = matrix_get_row(row);
-        const matrix_row_t row_changes = current_row ^ matrix_previous[row];
+        const matrix_row_t current_row = change_set.current[row];
+        matrix_row_t       row_changes = change_set.changes[row];
 
         if (!row_changes || has_ghost_in_row(row, current_row)) {
             continue;
         }
 
-        matrix_row_t col_mask = 1;
-        for (uint8_t col = 0; col < MATRIX_COLS; col++, col_mask <<= 1) {
-            if (row_changes & col_mask) {
-                const bool key_pressed = current_row & col_mask;
-
-                if (process_keypress) {
-                    action_exec(MAKE_KEYEVENT(row, col, key_pressed));
-                }
+        // Visit changed columns in ascending order, lowest set bit first
+        do {
+            const uint8_t      col         = matrix_row_lowest_col(row_changes);
+            const matrix_row_t col_mask    = MATRIX_ROW_SHIFTER << col;
+            const bool         key_pressed = current_row & col_mask;
 
-                switch_events(row, col, key_pressed);
+            if (process_keypress) {
+                const keyevent_t event = MAKE_KEYEVENT(row, col, key_pressed);
+#ifdef LATENCY_TRACE_ENABLE
+                latency_trace_edge(event);
+#endif
+#ifdef MATRIX_TRACE_ENABLE
+                matrix_trace_record(event);
+#endif
+                action_exec(event);
             }
-        }
+
+            switch_events(row, col, key_pressed);
+
+            row_changes &= ~col_mask;
+        } while (row_changes);
 
         matrix_previous[row] = current_row;
     }
@@ -667,7 +753,10 @@ void quantum_task(void) {
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+    PROBE_BEGIN(PROFILING_PROBE_MATRIX_TASK);
+    bool matrix_changed = matrix_task();
+    PROBE_END(PROFILING_PROBE_MATRIX_TASK);
+    if (matrix_changed) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
@@ -686,7 +775,9 @@ void keyboard_task(void) {
     led_matrix_task();
 #endif
 #ifdef RGB_MATRIX_ENABLE
+    PROBE_BEGIN(PROFILING_PROBE_RGB_MATRIX_TASK);
     rgb_matrix_task();
+    PROBE_END(PROFILING_PROBE_RGB_MATRIX_TASK);
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
@@ -755,4 +846,8 @@ void keyboard_task(void) {
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+
+#ifdef PROFILING_ENABLE
+    profiling_task();
+#endif
 }
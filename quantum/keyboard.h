@@ -137,7 +137,8 @@ uint32_t last_pointing_device_activity_elapsed(void); // Number of milliseconds
 
 void set_activity_timestamps(uint32_t matrix_timestamp, uint32_t encoder_timestamp, uint32_t pointing_device_timestamp); // Set the timestamps of the last matrix and encoder activity
 
-uint32_t get_matrix_scan_rate(void);
+uint32_t get_matrix_scan_rate(void);      // Main loop iterations per second
+uint32_t get_matrix_full_scan_rate(void); // Full matrix walks per second, lower than the scan rate when MATRIX_EDGE_SCAN skips idle walks
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,150 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "latency_trace.h"
+#include "profiling.h"
+#include "debug.h"
+
+typedef enum {
+    TRACE_FREE,
+    TRACE_OPEN,       // seen by the matrix scan
+    TRACE_HELD,       // parked in a tapping or combo buffer
+    TRACE_DISPATCHED, // being processed, waiting for a report
+} trace_state_t;
+
+typedef struct {
+    keypos_t key;
+    bool     pressed;
+    uint8_t  state;
+    uint8_t  path;
+    uint8_t  sequence;
+    uint32_t start;
+} latency_trace_t;
+
+_Static_assert(LATENCY_TRACE_SLOTS <= sizeof(latency_trace_set_t) * 8, "LATENCY_TRACE_SLOTS does not fit into latency_trace_set_t");
+
+static latency_trace_t traces[LATENCY_TRACE_SLOTS];
+static uint32_t        scan_start;
+static uint8_t         next_sequence;
+
+static uint8_t path_probe(uint8_t path) {
+    if (path & LATENCY_TRACE_COMBO) {
+        return PROFILING_PROBE_LATENCY_COMBO;
+    }
+    if (path & LATENCY_TRACE_TAPPING) {
+        return PROFILING_PROBE_LATENCY_TAPPING;
+    }
+    return PROFILING_PROBE_LATENCY_DIRECT;
+}
+
+/* Oldest trace for this key edge in one of the given states. */
+static uint8_t trace_find(keyevent_t event, uint8_t state_mask) {
+    uint8_t found = LATENCY_TRACE_NONE;
+    uint8_t age   = 0;
+
+    if (!IS_KEYEVENT(event)) {
+        return LATENCY_TRACE_NONE;
+    }
+    for (uint8_t i = 0; i < LATENCY_TRACE_SLOTS; i++) {
+        latency_trace_t *trace = &traces[i];
+        if (!(state_mask & (1 << trace->state)) || trace->pressed != event.pressed || !KEYEQ(trace->key, event.key)) {
+            continue;
+        }
+        uint8_t trace_age = next_sequence - trace->sequence;
+        if (found == LATENCY_TRACE_NONE || trace_age > age) {
+            found = i;
+            age   = trace_age;
+        }
+    }
+    return found;
+}
+
+void latency_trace_scan_start(void) {
+    scan_start = profiling_clock_read();
+}
+
+void latency_trace_edge(keyevent_t event) {
+    uint8_t slot = LATENCY_TRACE_NONE;
+    uint8_t age  = 0;
+
+    // Take a free slot, or evict the oldest, whose event never made it out
+    for (uint8_t i = 0; i < LATENCY_TRACE_SLOTS; i++) {
+        if (traces[i].state == TRACE_FREE) {
+            slot = i;
+            break;
+        }
+        uint8_t trace_age = next_sequence - traces[i].sequence;
+        if (slot == LATENCY_TRACE_NONE || trace_age > age) {
+            slot = i;
+            age  = trace_age;
+        }
+    }
+    if (traces[slot].state != TRACE_FREE) {
+        dprintf("latency_trace: dropped %u/%u\n", traces[slot].key.row, traces[slot].key.col);
+    }
+
+    traces[slot] = (latency_trace_t){
+        .key      = event.key,
+        .pressed  = event.pressed,
+        .state    = TRACE_OPEN,
+        .path     = LATENCY_TRACE_DIRECT,
+        .sequence = next_sequence++,
+        .start    = scan_start,
+    };
+}
+
+void latency_trace_hold(keyevent_t event, uint8_t path) {
+    uint8_t trace = trace_find(event, (1 << TRACE_OPEN) | (1 << TRACE_HELD) | (1 << TRACE_DISPATCHED));
+    if (trace != LATENCY_TRACE_NONE) {
+        traces[trace].state = TRACE_HELD;
+        traces[trace].path |= path;
+    }
+}
+
+uint8_t latency_trace_dispatch(keyevent_t event) {
+    uint8_t trace = trace_find(event, (1 << TRACE_OPEN) | (1 << TRACE_HELD));
+    if (trace != LATENCY_TRACE_NONE) {
+        traces[trace].state = TRACE_DISPATCHED;
+    }
+    return trace;
+}
+
+void latency_trace_settle(uint8_t trace) {
+    // Processed without sending a report, nothing to measure
+    if (trace != LATENCY_TRACE_NONE && traces[trace].state == TRACE_DISPATCHED) {
+        traces[trace].state = TRACE_FREE;
+    }
+}
+
+/* The held trace of this key edge, to be dispatched later along with others. */
+latency_trace_set_t latency_trace_claim(keyevent_t event) {
+    uint8_t trace = trace_find(event, 1 << TRACE_HELD);
+    return trace != LATENCY_TRACE_NONE ? (latency_trace_set_t)1 << trace : 0;
+}
+
+void latency_trace_dispatch_set(latency_trace_set_t set) {
+    for (uint8_t i = 0; i < LATENCY_TRACE_SLOTS; i++) {
+        if ((set & ((latency_trace_set_t)1 << i)) && traces[i].state == TRACE_HELD) {
+            traces[i].state = TRACE_DISPATCHED;
+        }
+    }
+}
+
+void latency_trace_settle_set(latency_trace_set_t set) {
+    for (uint8_t i = 0; i < LATENCY_TRACE_SLOTS; i++) {
+        if (set & ((latency_trace_set_t)1 << i)) {
+            latency_trace_settle(i);
+        }
+    }
+}
+
+void latency_trace_report(void) {
+    const uint32_t now = profiling_clock_read();
+    for (uint8_t i = 0; i < LATENCY_TRACE_SLOTS; i++) {
+        latency_trace_t *trace = &traces[i];
+        if (trace->state == TRACE_DISPATCHED) {
+            profiling_record_ticks(path_probe(trace->path), now - trace->start);
+            trace->state = TRACE_FREE;
+        }
+    }
+}
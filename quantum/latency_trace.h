@@ -0,0 +1,47 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include "keyboard.h"
+
+/*
+    End-to-end key latency tracer.
+
+    Every key edge is timestamped when the matrix scan that saw it starts, and
+    again when the keyboard report it produced leaves host_keyboard_send() (or
+    host_nkro_send()). The difference is recorded into one of the profiling
+    probes below, depending on which buffers held the event on the way:
+
+        latency_direct   processed in the scan it was seen in
+        latency_tapping  held as the tapping key or in the tapping waiting_buffer
+        latency_combo    held in the combo key_buffer
+
+    Events that end up not changing the report are not recorded.
+*/
+
+#ifndef LATENCY_TRACE_SLOTS
+#    define LATENCY_TRACE_SLOTS 8
+#endif
+
+#define LATENCY_TRACE_NONE 0xFF
+
+// One bit per trace slot, for edges that are dispatched together, such as the keys of a combo
+typedef uint32_t latency_trace_set_t;
+
+enum latency_trace_path {
+    LATENCY_TRACE_DIRECT  = 0,
+    LATENCY_TRACE_TAPPING = (1 << 0),
+    LATENCY_TRACE_COMBO   = (1 << 1),
+};
+
+void    latency_trace_scan_start(void);
+void    latency_trace_edge(keyevent_t event);
+void    latency_trace_hold(keyevent_t event, uint8_t path);
+uint8_t latency_trace_dispatch(keyevent_t event);
+void    latency_trace_settle(uint8_t trace);
+void    latency_trace_report(void);
+
+latency_trace_set_t latency_trace_claim(keyevent_t event);
+void                latency_trace_dispatch_set(latency_trace_set_t set);
+void                latency_trace_settle_set(latency_trace_set_t set);
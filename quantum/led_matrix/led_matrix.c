@@ -324,6 +324,17 @@ static void led_task_flush(uint8_t effect) {
     led_task_state = SYNCING;
 }
 
+#ifdef LED_MATRIX_INCREMENTAL_FLUSH
+// Flush one part of the changes per task run, so that a flush does not hold up
+// the scan for longer than a single bus transfer.
+static void led_task_flush_step(uint8_t effect) {
+    if (led_matrix_driver.flush_step && led_matrix_driver.flush_step()) {
+        return;
+    }
+    led_task_flush(effect);
+}
+#endif
+
 void led_matrix_task(void) {
     led_task_timers();
 
@@ -351,7 +362,11 @@ void led_matrix_task(void) {
             }
             break;
         case FLUSHING:
+#ifdef LED_MATRIX_INCREMENTAL_FLUSH
+            led_task_flush_step(effect);
+#else
             led_task_flush(effect);
+#endif
             break;
         case SYNCING:
             led_task_sync();
@@ -21,8 +21,8 @@
  *
  *    const led_matrix_driver_t led_matrix_driver;
  *
- * All members must be provided. Keyboard custom drivers must define this
- * in their own files.
+ * All members except flush_step must be provided. Keyboard custom drivers
+ * must define this in their own files.
  */
 
 #if defined(LED_MATRIX_IS31FL3218)
@@ -45,6 +45,7 @@ const led_matrix_driver_t led_matrix_driver = {
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3729_init_drivers,
     .flush         = is31fl3729_flush,
+    .flush_step    = is31fl3729_flush_step,
     .set_value     = is31fl3729_set_value,
     .set_value_all = is31fl3729_set_value_all,
 };
@@ -53,6 +54,7 @@ const led_matrix_driver_t led_matrix_driver = {
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3731_init_drivers,
     .flush         = is31fl3731_flush,
+    .flush_step    = is31fl3731_flush_step,
     .set_value     = is31fl3731_set_value,
     .set_value_all = is31fl3731_set_value_all,
 };
@@ -61,6 +63,7 @@ const led_matrix_driver_t led_matrix_driver = {
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3733_init_drivers,
     .flush         = is31fl3733_flush,
+    .flush_step    = is31fl3733_flush_step,
     .set_value     = is31fl3733_set_value,
     .set_value_all = is31fl3733_set_value_all,
 };
@@ -69,6 +72,7 @@ const led_matrix_driver_t led_matrix_driver = {
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3736_init_drivers,
     .flush         = is31fl3736_flush,
+    .flush_step    = is31fl3736_flush_step,
     .set_value     = is31fl3736_set_value,
     .set_value_all = is31fl3736_set_value_all,
 };
@@ -77,6 +81,7 @@ const led_matrix_driver_t led_matrix_driver = {
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3737_init_drivers,
     .flush         = is31fl3737_flush,
+    .flush_step    = is31fl3737_flush_step,
     .set_value     = is31fl3737_set_value,
     .set_value_all = is31fl3737_set_value_all,
 };
@@ -85,6 +90,7 @@ const led_matrix_driver_t led_matrix_driver = {
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3741_init_drivers,
     .flush         = is31fl3741_flush,
+    .flush_step    = is31fl3741_flush_step,
     .set_value     = is31fl3741_set_value,
     .set_value_all = is31fl3741_set_value_all,
 };
@@ -93,6 +99,7 @@ const led_matrix_driver_t led_matrix_driver = {
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3742a_init_drivers,
     .flush         = is31fl3742a_flush,
+    .flush_step    = is31fl3742a_flush_step,
     .set_value     = is31fl3742a_set_value,
     .set_value_all = is31fl3742a_set_value_all,
 };
@@ -101,6 +108,7 @@ const led_matrix_driver_t led_matrix_driver = {
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3743a_init_drivers,
     .flush         = is31fl3743a_flush,
+    .flush_step    = is31fl3743a_flush_step,
     .set_value     = is31fl3743a_set_value,
     .set_value_all = is31fl3743a_set_value_all,
 };
@@ -109,6 +117,7 @@ const led_matrix_driver_t led_matrix_driver = {
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3745_init_drivers,
     .flush         = is31fl3745_flush,
+    .flush_step    = is31fl3745_flush_step,
     .set_value     = is31fl3745_set_value,
     .set_value_all = is31fl3745_set_value_all,
 };
@@ -117,6 +126,7 @@ const led_matrix_driver_t led_matrix_driver = {
 const led_matrix_driver_t led_matrix_driver = {
     .init          = is31fl3746a_init_drivers,
     .flush         = is31fl3746a_flush,
+    .flush_step    = is31fl3746a_flush_step,
     .set_value     = is31fl3746a_set_value,
     .set_value_all = is31fl3746a_set_value_all,
 };
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #if defined(LED_MATRIX_IS31FL3218)
 #    include "is31fl3218-mono.h"
@@ -43,6 +44,8 @@ typedef struct {
     void (*set_value_all)(uint8_t value);
     /* Flush any buffered changes to the hardware. */
     void (*flush)(void);
+    /* Optional: flush part of the buffered changes, returning false once there is nothing left to flush. */
+    bool (*flush_step)(void);
 } led_matrix_driver_t;
 
 extern const led_matrix_driver_t led_matrix_driver;
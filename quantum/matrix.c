@@ -270,6 +270,137 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
 #    error DIODE_DIRECTION is not defined!
 #endif
 
+#ifdef MATRIX_EDGE_SCAN
+#    if !defined(DIRECT_PINS) && !(defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS))
+#        error MATRIX_EDGE_SCAN requires either DIRECT_PINS or MATRIX_ROW_PINS and MATRIX_COL_PINS
+#    endif
+
+#    if !defined(MATRIX_EDGE_SCAN_INTERRUPT) && defined(PROTOCOL_CHIBIOS) && (PAL_USE_CALLBACKS == TRUE)
+#        define MATRIX_EDGE_SCAN_INTERRUPT
+#        define matrix_edge_line_enable(pin, callback)                                                                              \
+            do {                                                                                                                     \
+                palEnableLineEvent(pin, MATRIX_INPUT_PRESSED_STATE ? PAL_EVENT_MODE_RISING_EDGE : PAL_EVENT_MODE_FALLING_EDGE); \
+                palSetLineCallback(pin, callback, NULL);                                                                         \
+            } while (0)
+#        define matrix_edge_line_disable(pin) palDisableLineEvent(pin)
+#    endif
+
+/* Lines that report a key press while the matrix is armed */
+#    if defined(DIRECT_PINS)
+#        define MATRIX_EDGE_SENSE_LINES (ROWS_PER_HAND * MATRIX_COLS)
+#        define matrix_edge_sense_pin(i) (direct_pins[(i) / MATRIX_COLS][(i) % MATRIX_COLS])
+#    elif (DIODE_DIRECTION == COL2ROW)
+#        define MATRIX_EDGE_SENSE_LINES MATRIX_COLS
+#        define matrix_edge_sense_pin(i) (col_pins[i])
+#    elif (DIODE_DIRECTION == ROW2COL)
+#        define MATRIX_EDGE_SENSE_LINES ROWS_PER_HAND
+#        define matrix_edge_sense_pin(i) (row_pins[i])
+#    endif
+
+static bool     matrix_armed      = false;
+static uint32_t matrix_full_scans = 0;
+
+#    ifdef MATRIX_EDGE_SCAN_INTERRUPT
+static volatile bool matrix_edge_latched = false;
+
+static void matrix_edge_callback(void *arg) {
+    matrix_edge_latched = true;
+}
+#    endif
+
+static bool matrix_edge_sense_pressed(void) {
+    for (uint8_t i = 0; i < MATRIX_EDGE_SENSE_LINES; i++) {
+        if (readMatrixPin(matrix_edge_sense_pin(i)) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Selects every output line at once so that any key press shows up
+ * on the sense lines, letting idle loops skip the row/col walk.
+ */
+static void matrix_edge_arm(void) {
+#    if !defined(DIRECT_PINS) && (DIODE_DIRECTION == COL2ROW)
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        select_row(row);
+    }
+#    elif !defined(DIRECT_PINS) && (DIODE_DIRECTION == ROW2COL)
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        select_col(col);
+    }
+#    endif
+    matrix_output_select_delay();
+
+#    ifdef MATRIX_EDGE_SCAN_INTERRUPT
+    matrix_edge_latched = false;
+    for (uint8_t i = 0; i < MATRIX_EDGE_SENSE_LINES; i++) {
+        pin_t pin = matrix_edge_sense_pin(i);
+        if (pin != NO_PIN) {
+            matrix_edge_line_enable(pin, matrix_edge_callback);
+        }
+    }
+    // catch presses that landed between the last walk and enabling the line events
+    if (matrix_edge_sense_pressed()) {
+        matrix_edge_latched = true;
+    }
+#    endif
+
+    matrix_armed = true;
+}
+
+static void matrix_edge_disarm(void) {
+#    ifdef MATRIX_EDGE_SCAN_INTERRUPT
+    for (uint8_t i = 0; i < MATRIX_EDGE_SENSE_LINES; i++) {
+        pin_t pin = matrix_edge_sense_pin(i);
+        if (pin != NO_PIN) {
+            matrix_edge_line_disable(pin);
+        }
+    }
+#    endif
+
+#    if !defined(DIRECT_PINS) && (DIODE_DIRECTION == COL2ROW)
+    unselect_rows();
+    matrix_output_unselect_delay(0, true);
+#    elif !defined(DIRECT_PINS) && (DIODE_DIRECTION == ROW2COL)
+    unselect_cols();
+    matrix_output_unselect_delay(0, true);
+#    endif
+
+    matrix_armed = false;
+}
+
+static bool matrix_edge_pending(void) {
+#    ifdef MATRIX_EDGE_SCAN_INTERRUPT
+    return matrix_edge_latched;
+#    else
+    return matrix_edge_sense_pressed();
+#    endif
+}
+
+/**
+ * @brief The local half may only go idle once no key is held and the
+ * debouncer has nothing left to report.
+ */
+static bool matrix_local_is_idle(void) {
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+#    ifdef SPLIT_KEYBOARD
+        if (raw_matrix[row] || matrix[thisHand + row]) {
+#    else
+        if (raw_matrix[row] || matrix[row]) {
+#    endif
+            return false;
+        }
+    }
+    return true;
+}
+
+uint32_t matrix_edge_scan_full_count(void) {
+    return matrix_full_scans;
+}
+#endif // MATRIX_EDGE_SCAN
+
 void matrix_init(void) {
 #ifdef SPLIT_KEYBOARD
     // Set pinout for right half if pinout for that half is defined
@@ -302,6 +433,9 @@ void matrix_init(void) {
 
     // initialize key pins
     matrix_init_pins();
+#ifdef MATRIX_EDGE_SCAN
+    matrix_armed = false;
+#endif
 
     // initialize matrix state: all keys off
     memset(matrix, 0, sizeof(matrix));
@@ -320,7 +454,7 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 }
 #endif
 
-uint8_t matrix_scan(void) {
+static bool matrix_scan_local(void) {
     matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
 
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
@@ -340,9 +474,34 @@ uint8_t matrix_scan(void) {
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
 
 #ifdef SPLIT_KEYBOARD
-    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
+    return debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed);
+#else
+    return debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
+#endif
+}
+
+uint8_t matrix_scan(void) {
+#ifdef MATRIX_EDGE_SCAN
+    bool changed = false;
+    if (!matrix_armed || matrix_edge_pending()) {
+        if (matrix_armed) {
+            matrix_edge_disarm();
+        }
+
+        changed = matrix_scan_local();
+        matrix_full_scans++;
+
+        if (matrix_local_is_idle()) {
+            matrix_edge_arm();
+        }
+    }
+#else
+    bool changed = matrix_scan_local();
+#endif
+
+#ifdef SPLIT_KEYBOARD
+    changed |= matrix_post_scan();
 #else
-    changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
     matrix_scan_kb();
 #endif
     return (uint8_t)changed;
@@ -75,6 +75,11 @@ void matrix_scan_kb(void);
 void matrix_init_user(void);
 void matrix_scan_user(void);
 
+#ifdef MATRIX_EDGE_SCAN
+/* number of full matrix walks performed, idle loops are not counted */
+uint32_t matrix_edge_scan_full_count(void);
+#endif
+
 #ifdef SPLIT_KEYBOARD
 bool matrix_post_scan(void);
 void matrix_slave_scan_kb(void);
@@ -0,0 +1,15 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "matrix_trace.h"
+#include "timer.h"
+#include "debug.h"
+#include "print.h"
+
+void matrix_trace_record(keyevent_t event) {
+    if (!debug_enable) {
+        return;
+    }
+    // the 16 bit event time wraps after a minute, sessions are much longer
+    uprintf(MATRIX_TRACE_TAG " %lu %u %u %u\n", (unsigned long)timer_read32(), event.key.row, event.key.col, event.pressed);
+}
@@ -0,0 +1,21 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include "keyboard.h"
+
+/*
+    Matrix event capture, for replaying real typing sessions in the unit tests.
+
+    While debug is enabled, every key edge seen by matrix_task() is printed to
+    the console as
+
+        matrix_trace: <time ms> <row> <col> <1 pressed | 0 released>
+
+    Save the output of `qmk console` and feed it to the TraceReplay helper in
+    tests/test_common, any other console output is ignored there.
+*/
+
+#define MATRIX_TRACE_TAG "matrix_trace:"
+
+void matrix_trace_record(keyevent_t event);
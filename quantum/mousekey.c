@@ -52,6 +52,14 @@ static int8_t  mousekey_y_inertia = 0; // ...
 #ifdef MK_KINETIC_SPEED
 static uint16_t mouse_timer = 0;
 #endif
+#ifdef MOUSEKEY_SUBPIXEL
+static int32_t  mousekey_x_remainder = 0; // motion not reported yet, in 1/256 units times the interval
+static int32_t  mousekey_y_remainder = 0; // ...
+static int32_t  mousekey_v_remainder = 0; // ...
+static int32_t  mousekey_h_remainder = 0; // ...
+static uint16_t mousekey_cursor_time = 0; // milliseconds of continuous motion, drives acceleration
+static uint16_t mousekey_wheel_time  = 0; // ...
+#endif
 
 #ifndef MK_3_SPEED
 
@@ -282,6 +290,76 @@ static uint8_t wheel_unit(void) {
 
 #    endif /* #ifndef MK_COMBINED */
 
+#    ifdef MOUSEKEY_SUBPIXEL
+
+/*
+ * Sub-pixel motion
+ *
+ * Speeds are Q8.8 fixed-point pixels (or wheel steps) per interval, integrated
+ * over the time that actually passed since the previous step. The fraction
+ * that doesn't make a whole pixel is carried to the next report instead of
+ * being rounded, so slow and diagonal motion stays smooth, and the reports can
+ * be sent more often without changing the speed.
+ *
+ *  speed = delta + (delta * max_speed - delta) * curve(time / (time_to_max * interval))
+ */
+int8_t mk_curve = MOUSEKEY_CURVE;
+
+#        ifdef MOUSEKEY_HIGH_RATE
+#            define MOUSEKEY_CURSOR_STEP MOUSEKEY_HIGH_RATE_INTERVAL
+#            define MOUSEKEY_WHEEL_STEP MOUSEKEY_HIGH_RATE_INTERVAL
+#        else
+#            define MOUSEKEY_CURSOR_STEP mk_interval
+#            define MOUSEKEY_WHEEL_STEP mk_wheel_interval
+#        endif
+
+/* Acceleration curve over progress 0-256: linear at mk_curve 0, close to
+ * x**2 at 127 and to 1-(1-x)**2 at -128. */
+static uint16_t subpixel_curve(uint16_t progress) {
+    return progress - ((int32_t)mk_curve * progress * (256 - progress)) / (256 * 128);
+}
+
+static uint32_t subpixel_speed(uint8_t delta, uint8_t max_speed, uint8_t time_to_max, uint8_t interval, uint16_t time, uint8_t limit) {
+    const uint32_t max = (uint32_t)delta * max_speed * 256;
+    uint32_t       speed;
+    if (mousekey_accel & (1 << 0)) {
+        speed = max / 4;
+    } else if (mousekey_accel & (1 << 1)) {
+        speed = max / 2;
+    } else if (mousekey_accel & (1 << 2)) {
+        speed = max;
+    } else {
+        const uint32_t min      = (uint32_t)delta * 256;
+        const uint32_t ramp     = (uint32_t)time_to_max * interval;
+        const uint16_t progress = (time >= ramp) ? 256 : (uint32_t)time * 256 / ramp;
+        speed                   = max > min ? min + (max - min) * subpixel_curve(progress) / 256 : min;
+    }
+    return speed > (uint32_t)limit * 256 ? (uint32_t)limit * 256 : speed;
+}
+
+/* Moves `direction` at `speed` per `interval` for `elapsed` milliseconds,
+ * returns the whole units to report and keeps the rest in `remainder`. */
+static int8_t subpixel_step(int32_t *remainder, int16_t direction, uint32_t speed, uint8_t elapsed, uint8_t interval, uint8_t limit) {
+    if (direction == 0) {
+        return 0;
+    }
+    // Scaled by the interval rather than divided by it, so that steps shorter than the interval don't truncate
+    const int32_t unit     = 256 * (interval ? interval : 1);
+    const int32_t distance = speed * elapsed;
+    const int32_t motion   = *remainder + (direction > 0 ? distance : -distance);
+    int32_t       units    = motion / unit;
+
+    *remainder = motion - units * unit;
+    if (units > limit) {
+        units = limit;
+    } else if (units < -limit) {
+        units = -limit;
+    }
+    return units;
+}
+
+#    endif /* #ifdef MOUSEKEY_SUBPIXEL */
+
 #    ifdef MOUSEKEY_INERTIA
 
 static int8_t calc_inertia(int8_t direction, int8_t velocity) {
@@ -337,6 +415,41 @@ void mousekey_task(void) {
         tmpmr.y        = 0;
     }
 
+#    elif defined(MOUSEKEY_SUBPIXEL)
+
+    if ((tmpmr.x || tmpmr.y) && timer_elapsed(last_timer_c) >= (mousekey_repeat ? MOUSEKEY_CURSOR_STEP : mk_delay * 10)) {
+        // The first step after the delay moves by one interval
+        const uint16_t since   = timer_elapsed(last_timer_c);
+        const uint8_t  elapsed = mousekey_repeat ? (since > UINT8_MAX ? UINT8_MAX : since) : mk_interval;
+        uint32_t       speed   = subpixel_speed(MOUSEKEY_MOVE_DELTA, mk_max_speed, mk_time_to_max, mk_interval, mousekey_cursor_time, MOUSEKEY_MOVE_MAX);
+
+        last_timer_c = timer_read();
+        if (mousekey_repeat != UINT8_MAX) mousekey_repeat++;
+        if (mousekey_cursor_time < UINT16_MAX - elapsed) mousekey_cursor_time += elapsed;
+
+        /* diagonal move [1/sqrt(2)] */
+        if (tmpmr.x && tmpmr.y) speed = speed * 181 / 256;
+
+        mouse_report.x = subpixel_step(&mousekey_x_remainder, tmpmr.x, speed, elapsed, mk_interval, MOUSEKEY_MOVE_MAX);
+        mouse_report.y = subpixel_step(&mousekey_y_remainder, tmpmr.y, speed, elapsed, mk_interval, MOUSEKEY_MOVE_MAX);
+    }
+
+    if ((tmpmr.v || tmpmr.h) && timer_elapsed(last_timer_w) >= (mousekey_wheel_repeat ? MOUSEKEY_WHEEL_STEP : mk_wheel_delay * 10)) {
+        const uint16_t since   = timer_elapsed(last_timer_w);
+        const uint8_t  elapsed = mousekey_wheel_repeat ? (since > UINT8_MAX ? UINT8_MAX : since) : mk_wheel_interval;
+        uint32_t       speed   = subpixel_speed(MOUSEKEY_WHEEL_DELTA, mk_wheel_max_speed, mk_wheel_time_to_max, mk_wheel_interval, mousekey_wheel_time, MOUSEKEY_WHEEL_MAX);
+
+        last_timer_w = timer_read();
+        if (mousekey_wheel_repeat != UINT8_MAX) mousekey_wheel_repeat++;
+        if (mousekey_wheel_time < UINT16_MAX - elapsed) mousekey_wheel_time += elapsed;
+
+        /* diagonal move [1/sqrt(2)] */
+        if (tmpmr.v && tmpmr.h) speed = speed * 181 / 256;
+
+        mouse_report.v = subpixel_step(&mousekey_v_remainder, tmpmr.v, speed, elapsed, mk_wheel_interval, MOUSEKEY_WHEEL_MAX);
+        mouse_report.h = subpixel_step(&mousekey_h_remainder, tmpmr.h, speed, elapsed, mk_wheel_interval, MOUSEKEY_WHEEL_MAX);
+    }
+
 #    else // default acceleration
 
     if ((tmpmr.x || tmpmr.y) && timer_elapsed(last_timer_c) > (mousekey_repeat ? mk_interval : mk_delay * 10)) {
@@ -357,8 +470,9 @@ void mousekey_task(void) {
         }
     }
 
-#    endif // MOUSEKEY_INERTIA or not
+#    endif // MOUSEKEY_INERTIA, MOUSEKEY_SUBPIXEL or not
 
+#    ifndef MOUSEKEY_SUBPIXEL
     if ((tmpmr.v || tmpmr.h) && timer_elapsed(last_timer_w) > (mousekey_wheel_repeat ? mk_wheel_interval : mk_wheel_delay * 10)) {
         if (mousekey_wheel_repeat != UINT8_MAX) mousekey_wheel_repeat++;
         if (tmpmr.v != 0) mouse_report.v = wheel_unit() * ((tmpmr.v > 0) ? 1 : -1);
@@ -376,6 +490,7 @@ void mousekey_task(void) {
             }
         }
     }
+#    endif
 
     if (has_mouse_report_changed(&mouse_report, &tmpmr) || should_mousekey_report_send(&mouse_report)) {
         mousekey_send();
@@ -400,6 +515,10 @@ void mousekey_on(uint8_t code) {
 #        else
         mousekey_repeat       = MOUSEKEY_OVERLAP_MOVE_DELTA;
         mousekey_wheel_repeat = MOUSEKEY_OVERLAP_WHEEL_DELTA;
+#        endif
+#        ifdef MOUSEKEY_SUBPIXEL
+        mousekey_cursor_time = 0;
+        mousekey_wheel_time  = 0;
 #        endif
     }
 #    endif // defined(MOUSEKEY_OVERLAP_RESET) && !defined(MOUSEKEY_INERTIA)
@@ -493,8 +612,20 @@ void mousekey_off(uint8_t code) {
 #    ifdef MK_KINETIC_SPEED
         mouse_timer = 0;
 #    endif /* #ifdef MK_KINETIC_SPEED */
+#    ifdef MOUSEKEY_SUBPIXEL
+        mousekey_x_remainder = 0;
+        mousekey_y_remainder = 0;
+        mousekey_cursor_time = 0;
+#    endif
+    }
+    if (mouse_report.v == 0 && mouse_report.h == 0) {
+        mousekey_wheel_repeat = 0;
+#    ifdef MOUSEKEY_SUBPIXEL
+        mousekey_v_remainder = 0;
+        mousekey_h_remainder = 0;
+        mousekey_wheel_time  = 0;
+#    endif
     }
-    if (mouse_report.v == 0 && mouse_report.h == 0) mousekey_wheel_repeat = 0;
 }
 
 #else /* #ifndef MK_3_SPEED */
@@ -650,6 +781,14 @@ void mousekey_clear(void) {
     mousekey_x_dir     = 0;
     mousekey_y_dir     = 0;
 #endif
+#ifdef MOUSEKEY_SUBPIXEL
+    mousekey_x_remainder = 0;
+    mousekey_y_remainder = 0;
+    mousekey_v_remainder = 0;
+    mousekey_h_remainder = 0;
+    mousekey_cursor_time = 0;
+    mousekey_wheel_time  = 0;
+#endif
 }
 
 static void mousekey_debug(void) {
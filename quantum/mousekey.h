@@ -120,6 +120,24 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #        define MOUSEKEY_WHEEL_DECELERATED_MOVEMENTS 8
 #    endif
 
+#    ifdef MOUSEKEY_SUBPIXEL
+#        if defined(MK_KINETIC_SPEED) || defined(MK_COMBINED) || defined(MOUSEKEY_INERTIA)
+#            error MOUSEKEY_SUBPIXEL is only supported in accelerated mode
+#        endif
+#        ifndef MOUSEKEY_CURVE
+#            define MOUSEKEY_CURVE 0 // -128 (fast start) to 127 (slow start), 0 is linear
+#        endif
+#        ifndef MOUSEKEY_HIGH_RATE_INTERVAL
+#            ifdef USB_POLLING_INTERVAL_MS
+#                define MOUSEKEY_HIGH_RATE_INTERVAL USB_POLLING_INTERVAL_MS
+#            else
+#                define MOUSEKEY_HIGH_RATE_INTERVAL 1
+#            endif
+#        endif
+#    elif defined(MOUSEKEY_HIGH_RATE)
+#        error MOUSEKEY_HIGH_RATE requires MOUSEKEY_SUBPIXEL
+#    endif
+
 #else /* #ifndef MK_3_SPEED */
 
 #    ifndef MK_C_OFFSET_UNMOD
@@ -172,6 +190,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #        define MK_W_INTERVAL_2 20
 #    endif
 
+#    if defined(MOUSEKEY_SUBPIXEL) || defined(MOUSEKEY_HIGH_RATE)
+#        error MOUSEKEY_SUBPIXEL is only supported in accelerated mode
+#    endif
+
 #endif /* #ifndef MK_3_SPEED */
 
 #ifndef MOUSEKEY_OVERLAP_MOVE_DELTA
@@ -194,6 +216,9 @@ extern uint8_t mk_max_speed;
 extern uint8_t mk_time_to_max;
 extern uint8_t mk_wheel_max_speed;
 extern uint8_t mk_wheel_time_to_max;
+#ifdef MOUSEKEY_SUBPIXEL
+extern int8_t mk_curve;
+#endif
 
 void           mousekey_task(void);
 void           mousekey_on(uint8_t code);
@@ -239,6 +239,136 @@ report_mouse_t pointing_device_adjust_by_defines(report_mouse_t mouse_report) {
     return mouse_report;
 }
 
+#ifdef POINTING_DEVICE_MOTION_COALESCE
+static int32_t coalesced_x = 0;
+static int32_t coalesced_y = 0;
+static int32_t coalesced_h = 0;
+static int32_t coalesced_v = 0;
+#    ifdef POINTING_DEVICE_IDLE_THROTTLE_MS
+static uint32_t last_motion = 0;
+#    endif
+
+/**
+ * @brief Adds motion to an accumulator, keeping at most POINTING_DEVICE_COALESCE_MAX reports of backlog
+ *
+ * Without the cap, motion faster than one full report per interval would pile up and keep moving the cursor long
+ * after the sensor stopped.
+ *
+ * @param[in] accumulator int32_t pointer to the accumulated motion
+ * @param[in] delta int16_t motion to add
+ * @param[in] limit int32_t largest magnitude that fits into one report
+ */
+static void pointing_device_accumulate(int32_t *accumulator, int16_t delta, int32_t limit) {
+    const int32_t max   = limit * POINTING_DEVICE_COALESCE_MAX;
+    int32_t       value = *accumulator + delta;
+    if (value > max) {
+        value = max;
+    } else if (value < -max) {
+        value = -max;
+    }
+    *accumulator = value;
+}
+
+/**
+ * @brief Adds sensor motion to the accumulator
+ *
+ * Lets a driver hand over its full delta instead of clamping it to the report range in get_report. The excess is split
+ * across the following reports.
+ *
+ * NOTE: Only available when using POINTING_DEVICE_MOTION_COALESCE
+ *
+ * @param[in] x int16_t
+ * @param[in] y int16_t
+ */
+void pointing_device_accumulate_motion(int16_t x, int16_t y) {
+    pointing_device_accumulate(&coalesced_x, x, XY_REPORT_MAX);
+    pointing_device_accumulate(&coalesced_y, y, XY_REPORT_MAX);
+#    ifdef POINTING_DEVICE_IDLE_THROTTLE_MS
+    if (x || y) {
+        last_motion = timer_read32();
+    }
+#    endif
+}
+
+/**
+ * @brief Takes as much of the accumulated motion as fits into one report
+ *
+ * The range is kept symmetric, so that inverting or rotating the result can not overflow.
+ *
+ * @param[in] accumulator int32_t pointer to the accumulated motion, which keeps the rest
+ * @param[in] limit int32_t largest magnitude that fits into the report
+ * @return int32_t motion to report
+ */
+static int32_t pointing_device_drain(int32_t *accumulator, int32_t limit) {
+    int32_t value = *accumulator;
+    if (value > limit) {
+        value = limit;
+    } else if (value < -limit) {
+        value = -limit;
+    }
+    *accumulator -= value;
+    return value;
+}
+
+/**
+ * @brief Polls the sensor at its own rate and coalesces the motion into reports
+ *
+ * The sensor is read every POINTING_DEVICE_TASK_THROTTLE_MS (every scan by default), and only while the motion pin is
+ * active if there is one, or every POINTING_DEVICE_IDLE_THROTTLE_MS once it has been still for a while. Its motion is
+ * summed up and moved into the report every POINTING_DEVICE_REPORT_INTERVAL_MS.
+ *
+ * @return true if a report is due
+ */
+static bool pointing_device_coalesce(void) {
+    static uint32_t last_read   = 0;
+    static uint32_t last_report = 0;
+#    ifdef POINTING_DEVICE_IDLE_THROTTLE_MS
+    const uint16_t throttle    = timer_elapsed32(last_motion) > POINTING_DEVICE_IDLE_TIMEOUT_MS ? POINTING_DEVICE_IDLE_THROTTLE_MS : POINTING_DEVICE_TASK_THROTTLE_MS;
+#    else
+    const uint16_t throttle = POINTING_DEVICE_TASK_THROTTLE_MS;
+#    endif
+
+#    ifdef POINTING_DEVICE_MOTION_PIN
+#        ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+    const bool motion = !gpio_read_pin(POINTING_DEVICE_MOTION_PIN);
+#        else
+    const bool motion = gpio_read_pin(POINTING_DEVICE_MOTION_PIN);
+#        endif
+#    else
+    const bool motion = true;
+#    endif
+
+    if (motion && timer_elapsed32(last_read) >= throttle) {
+        last_read = timer_read32();
+
+        report_mouse_t sensor_report = {.buttons = local_mouse_report.buttons};
+        sensor_report                = pointing_device_driver->get_report(sensor_report);
+        local_mouse_report.buttons   = sensor_report.buttons;
+
+        pointing_device_accumulate_motion(sensor_report.x, sensor_report.y);
+        pointing_device_accumulate(&coalesced_h, sensor_report.h, HV_REPORT_MAX);
+        pointing_device_accumulate(&coalesced_v, sensor_report.v, HV_REPORT_MAX);
+#    ifdef POINTING_DEVICE_IDLE_THROTTLE_MS
+        // Scrolling keeps the sensor awake as well.
+        if (sensor_report.h || sensor_report.v) {
+            last_motion = timer_read32();
+        }
+#    endif
+    }
+
+    if (timer_elapsed32(last_report) < POINTING_DEVICE_REPORT_INTERVAL_MS) {
+        return false;
+    }
+    last_report = timer_read32();
+
+    local_mouse_report.x = pointing_device_drain(&coalesced_x, XY_REPORT_MAX);
+    local_mouse_report.y = pointing_device_drain(&coalesced_y, XY_REPORT_MAX);
+    local_mouse_report.h = pointing_device_drain(&coalesced_h, HV_REPORT_MAX);
+    local_mouse_report.v = pointing_device_drain(&coalesced_v, HV_REPORT_MAX);
+    return true;
+}
+#endif
+
 /**
  * @brief Retrieves and processes pointing device data.
  *
@@ -254,45 +384,51 @@ __attribute__((weak)) bool pointing_device_task(void) {
     };
 #endif
 
-#if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
+#if defined(POINTING_DEVICE_MOTION_COALESCE)
+    if (!pointing_device_coalesce()) {
+        return false;
+    }
+#else
+#    if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
     static uint32_t last_exec = 0;
     if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
         return false;
     }
     last_exec = timer_read32();
-#endif
+#    endif
 
     // Gather report info
-#ifdef POINTING_DEVICE_MOTION_PIN
-#    if defined(SPLIT_POINTING_ENABLE)
-#        error POINTING_DEVICE_MOTION_PIN not supported when sharing the pointing device report between sides.
-#    endif
-#    ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+#    ifdef POINTING_DEVICE_MOTION_PIN
+#        if defined(SPLIT_POINTING_ENABLE)
+#            error POINTING_DEVICE_MOTION_PIN not supported when sharing the pointing device report between sides.
+#        endif
+#        ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
     if (!gpio_read_pin(POINTING_DEVICE_MOTION_PIN))
-#    else
+#        else
     if (gpio_read_pin(POINTING_DEVICE_MOTION_PIN))
-#    endif
+#        endif
     {
-#endif
+#    endif
 
-#if defined(SPLIT_POINTING_ENABLE)
-#    if defined(POINTING_DEVICE_COMBINED)
+#    if defined(SPLIT_POINTING_ENABLE)
+#        if defined(POINTING_DEVICE_COMBINED)
         static uint8_t old_buttons = 0;
         local_mouse_report.buttons = old_buttons;
         local_mouse_report         = pointing_device_driver->get_report(local_mouse_report);
         old_buttons                = local_mouse_report.buttons;
-#    elif defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT)
+#        elif defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT)
         local_mouse_report = POINTING_DEVICE_THIS_SIDE ? pointing_device_driver->get_report(local_mouse_report) : shared_mouse_report;
+#        else
+#            error "You need to define the side(s) the pointing device is on. POINTING_DEVICE_COMBINED / POINTING_DEVICE_LEFT / POINTING_DEVICE_RIGHT"
+#        endif
 #    else
-#        error "You need to define the side(s) the pointing device is on. POINTING_DEVICE_COMBINED / POINTING_DEVICE_LEFT / POINTING_DEVICE_RIGHT"
-#    endif
-#else
     local_mouse_report = pointing_device_driver->get_report(local_mouse_report);
-#endif // defined(SPLIT_POINTING_ENABLE)
+#    endif // defined(SPLIT_POINTING_ENABLE)
 
-#ifdef POINTING_DEVICE_MOTION_PIN
+#    ifdef POINTING_DEVICE_MOTION_PIN
     }
-#endif
+#    endif
+#endif // defined(POINTING_DEVICE_MOTION_COALESCE)
 
     // allow kb to intercept and modify report
 #if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
@@ -111,6 +111,28 @@ typedef int32_t hv_clamp_range_t;
 typedef int16_t hv_clamp_range_t;
 #endif
 
+#ifdef POINTING_DEVICE_MOTION_COALESCE
+#    if defined(SPLIT_POINTING_ENABLE)
+#        error POINTING_DEVICE_MOTION_COALESCE is not supported when sharing the pointing device report between sides.
+#    endif
+#    ifndef POINTING_DEVICE_REPORT_INTERVAL_MS
+#        ifdef USB_POLLING_INTERVAL_MS
+#            define POINTING_DEVICE_REPORT_INTERVAL_MS USB_POLLING_INTERVAL_MS
+#        else
+#            define POINTING_DEVICE_REPORT_INTERVAL_MS 1
+#        endif
+#    endif
+#    ifndef POINTING_DEVICE_TASK_THROTTLE_MS
+#        define POINTING_DEVICE_TASK_THROTTLE_MS 0
+#    endif
+#    ifndef POINTING_DEVICE_COALESCE_MAX
+#        define POINTING_DEVICE_COALESCE_MAX 4
+#    endif
+#    if defined(POINTING_DEVICE_IDLE_THROTTLE_MS) && !defined(POINTING_DEVICE_IDLE_TIMEOUT_MS)
+#        define POINTING_DEVICE_IDLE_TIMEOUT_MS 100
+#    endif
+#endif
+
 #define CONSTRAIN_HID(amt) ((amt) < INT8_MIN ? INT8_MIN : ((amt) > INT8_MAX ? INT8_MAX : (amt)))
 #define CONSTRAIN_HID_XY(amt) ((amt) < XY_REPORT_MIN ? XY_REPORT_MIN : ((amt) > XY_REPORT_MAX ? XY_REPORT_MAX : (amt)))
 
@@ -130,6 +152,10 @@ uint8_t        pointing_device_handle_buttons(uint8_t buttons, bool pressed, poi
 report_mouse_t pointing_device_adjust_by_defines(report_mouse_t mouse_report);
 void           pointing_device_keycode_handler(uint16_t keycode, bool pressed);
 
+#ifdef POINTING_DEVICE_MOTION_COALESCE
+void pointing_device_accumulate_motion(int16_t x, int16_t y);
+#endif
+
 #if defined(SPLIT_POINTING_ENABLE)
 void     pointing_device_set_shared_report(report_mouse_t report);
 uint16_t pointing_device_get_shared_cpi(void);
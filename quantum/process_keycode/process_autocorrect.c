@@ -19,9 +19,22 @@
 #    include "autocorrect_data_default.h"
 #endif
 
+#ifndef AUTOCORRECT_MAX_ACTIVE_STATES
+#    error "autocorrect_data.h is in an outdated format, regenerate it with 'qmk generate-autocorrect-data'"
+#endif
+
+/* Recently typed keys, as a ring buffer starting at typo_buffer_start. */
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
+static uint8_t typo_buffer_start                   = 0;
 static uint8_t typo_buffer_size                    = 1;
 
+/* Nodes of every typo that the buffer currently ends partway through, and the
+ * buffer size they were computed for. They are rebuilt from the buffer when
+ * its size changes behind our back, e.g. on backspace or a reset. */
+static uint16_t active_states[AUTOCORRECT_MAX_ACTIVE_STATES];
+static uint8_t  active_states_count = 0;
+static uint8_t  active_states_size  = 0;
+
 /**
  * @brief function for querying the enabled state of autocorrect
  *
@@ -189,6 +202,95 @@ __attribute__((weak)) bool apply_autocorrect(uint8_t backspaces, const char *str
     return true;
 }
 
+/**
+ * @brief get the position of a key in the typo buffer
+ *
+ * @param index position in the buffer, 0 being the oldest key
+ * @return index into typo_buffer
+ */
+static uint8_t typo_buffer_index(uint8_t index) {
+    index += typo_buffer_start;
+    return index < AUTOCORRECT_MAX_LENGTH ? index : index - AUTOCORRECT_MAX_LENGTH;
+}
+
+/**
+ * @brief find the child of a node for a key
+ *
+ * @param state offset of the node in `autocorrect_data`
+ * @param keycode basic keycode that was typed
+ * @return offset of the child node, or 0 if there is none
+ */
+static uint16_t autocorrect_child(uint16_t state, uint8_t keycode) {
+    const uint8_t code = pgm_read_byte(autocorrect_data + state);
+
+    if (code & 128) { // Leaf node, no children.
+        return 0;
+    }
+    if (!(code & 64)) { // Chain node, its only child follows.
+        return code == keycode ? state + 1 : 0;
+    }
+
+    // Branch node, if bit 5 is set the first child isn't linked but follows the links to the others.
+    const uint8_t  children = code & 31;
+    const uint16_t keys     = state + 1;
+    const uint16_t links    = keys + children;
+    for (uint8_t i = 0; i < children; ++i) {
+        const uint8_t key_i = pgm_read_byte(autocorrect_data + keys + i);
+        if (key_i == keycode) {
+            uint16_t link = links + 2 * i;
+            if (code & 32) {
+                if (i == 0) {
+                    return links + 2 * (children - 1);
+                }
+                link -= 2;
+            }
+            return pgm_read_byte(autocorrect_data + link) | pgm_read_byte(autocorrect_data + link + 1) << 8;
+        }
+        if (key_i > keycode) {
+            break;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief advance every active node by one key, and start a new typo at the root
+ *
+ * @param keycode basic keycode that was typed
+ * @return offset of the leaf of the typo that was completed, or 0 if none was
+ */
+static uint16_t autocorrect_advance(uint8_t keycode) {
+    uint16_t leaf  = 0;
+    uint8_t  count = 0;
+
+    for (uint8_t i = 0; i <= active_states_count; ++i) {
+        const uint16_t state = autocorrect_child(i < active_states_count ? active_states[i] : 0, keycode);
+
+        // Stop if `state` becomes an invalid index. This should not normally
+        // happen, it is a safeguard in case of a bug, data corruption, etc.
+        if (state == 0 || state >= DICTIONARY_SIZE) {
+            continue;
+        }
+        if (pgm_read_byte(autocorrect_data + state) & 128) {
+            leaf = state;
+        } else if (count < AUTOCORRECT_MAX_ACTIVE_STATES) {
+            active_states[count++] = state;
+        }
+    }
+    active_states_count = count;
+    return leaf;
+}
+
+/**
+ * @brief recompute the active nodes from the keys in the buffer
+ */
+static void autocorrect_rebuild_active_states(void) {
+    active_states_count = 0;
+    for (uint8_t i = 0; i < typo_buffer_size; ++i) {
+        autocorrect_advance(typo_buffer[typo_buffer_index(i)]);
+    }
+}
+
 /**
  * @brief Process handler for autocorrect feature
  *
@@ -266,111 +368,91 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
             return true;
     }
 
-    // Rotate oldest character if buffer is full.
+    if (active_states_size != typo_buffer_size) {
+        autocorrect_rebuild_active_states();
+    }
+
+    // Drop the oldest key if buffer is full.
     if (typo_buffer_size >= AUTOCORRECT_MAX_LENGTH) {
-        memmove(typo_buffer, typo_buffer + 1, AUTOCORRECT_MAX_LENGTH - 1);
-        typo_buffer_size = AUTOCORRECT_MAX_LENGTH - 1;
+        typo_buffer_start = typo_buffer_index(1);
+        --typo_buffer_size;
     }
 
     // Append `keycode` to buffer.
-    typo_buffer[typo_buffer_size++] = keycode;
-    // Return if buffer is smaller than the shortest word.
-    if (typo_buffer_size < AUTOCORRECT_MIN_LENGTH) {
+    typo_buffer[typo_buffer_index(typo_buffer_size++)] = keycode;
+
+    const uint16_t state = autocorrect_advance(keycode);
+    active_states_size   = typo_buffer_size;
+    if (!state) {
         return true;
     }
 
-    // Check for typo in buffer using a trie stored in `autocorrect_data`.
-    uint16_t state = 0;
-    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
-    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
-        uint8_t const key_i = typo_buffer[i];
-
-        if (code & 64) { // Check for match in node with multiple children.
-            code &= 63;
-            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
-                if (!code) return true;
-            }
-            // Follow link to child node.
-            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
-            // Check for match in node with single child.
-        } else if (code != key_i) {
-            return true;
-        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
-            ++state;
-        }
-
-        // Stop if `state` becomes an invalid index. This should not normally
-        // happen, it is a safeguard in case of a bug, data corruption, etc.
-        if (state >= DICTIONARY_SIZE) {
-            return true;
+    const uint8_t code = pgm_read_byte(autocorrect_data + state);
+
+    // A typo was found! Apply autocorrect.
+    const uint8_t backspaces = (code & 63) + !record->event.pressed;
+    const char *  changes    = (const char *)(autocorrect_data + state + 1);
+
+    /* Gather info about the typo'd word
+     *
+     * Since buffer may contain several words, delimited by spaces, we
+     * iterate from the end to find the start and length of the typo
+     */
+    char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
+
+    uint8_t typo_len   = 0;
+    uint8_t typo_start = 0;
+    bool    space_last = typo_buffer[typo_buffer_index(typo_buffer_size - 1)] == KC_SPC;
+    for (uint8_t i = typo_buffer_size; i > 0; --i) {
+        // stop counting after finding space (unless it is the last thing)
+        if (typo_buffer[typo_buffer_index(i - 1)] == KC_SPC && i != typo_buffer_size) {
+            typo_start = i;
+            break;
         }
 
-        code = pgm_read_byte(autocorrect_data + state);
-
-        if (code & 128) { // A typo was found! Apply autocorrect.
-            const uint8_t backspaces = (code & 63) + !record->event.pressed;
-            const char *  changes    = (const char *)(autocorrect_data + state + 1);
-
-            /* Gather info about the typo'd word
-             *
-             * Since buffer may contain several words, delimited by spaces, we
-             * iterate from the end to find the start and length of the typo
-             */
-            char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
-
-            uint8_t typo_len   = 0;
-            uint8_t typo_start = 0;
-            bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
-            for (uint8_t i = typo_buffer_size; i > 0; --i) {
-                // stop counting after finding space (unless it is the last thing)
-                if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
-                    typo_start = i;
-                    break;
-                }
-
-                ++typo_len;
-            }
-
-            // when detecting 'typo:', reduce the length of the string by one
-            if (space_last) {
-                --typo_len;
-            }
+        ++typo_len;
+    }
 
-            // convert buffer of keycodes into a string
-            for (uint8_t i = 0; i < typo_len; ++i) {
-                typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
-            }
+    // when detecting 'typo:', reduce the length of the string by one
+    if (space_last) {
+        --typo_len;
+    }
 
-            /* Gather the corrected word
-             *
-             * A) Correction of 'typo:' -- Code takes into account
-             * an extra backspace to delete the space (which we dont copy)
-             * for this reason the offset is correct to "skip" the null terminator
-             *
-             * B) When correcting 'typo' -- Need extra offset for terminator
-             */
-            char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
-
-            uint8_t offset = space_last ? backspaces : backspaces + 1;
-            strcpy(correct, typo);
-            strcpy_P(correct + typo_len - offset, changes);
-
-            if (apply_autocorrect(backspaces, changes, typo, correct)) {
-                for (uint8_t i = 0; i < backspaces; ++i) {
-                    tap_code(KC_BSPC);
-                }
-                send_string_P(changes);
-            }
+    // convert buffer of keycodes into a string
+    for (uint8_t i = 0; i < typo_len; ++i) {
+        typo[i] = typo_buffer[typo_buffer_index(typo_start + i)] - KC_A + 'a';
+    }
 
-            if (keycode == KC_SPC) {
-                typo_buffer[0]   = KC_SPC;
-                typo_buffer_size = 1;
-                return true;
-            } else {
-                typo_buffer_size = 0;
-                return false;
-            }
+    /* Gather the corrected word
+     *
+     * A) Correction of 'typo:' -- Code takes into account
+     * an extra backspace to delete the space (which we dont copy)
+     * for this reason the offset is correct to "skip" the null terminator
+     *
+     * B) When correcting 'typo' -- Need extra offset for terminator
+     */
+    char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
+
+    uint8_t offset = space_last ? backspaces : backspaces + 1;
+    strcpy(correct, typo);
+    strcpy_P(correct + typo_len - offset, changes);
+
+    if (apply_autocorrect(backspaces, changes, typo, correct)) {
+        for (uint8_t i = 0; i < backspaces; ++i) {
+            tap_code(KC_BSPC);
         }
+        send_string_P(changes);
+    }
+
+    typo_buffer_start   = 0;
+    active_states_count = 0;
+    active_states_size  = 0;
+    if (keycode == KC_SPC) {
+        typo_buffer[0]   = KC_SPC;
+        typo_buffer_size = 1;
+        return true;
+    } else {
+        typo_buffer_size = 0;
+        return false;
     }
-    return true;
 }
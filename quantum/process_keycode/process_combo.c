@@ -26,6 +26,10 @@
 #include "action_tapping.h"
 #include "action_util.h"
 #include "keymap_introspection.h"
+#include "debug.h"
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
 
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
@@ -89,6 +93,9 @@ typedef struct {
     keyrecord_t record;
     uint16_t    combo_index;
     uint16_t    keycode;
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_set_t latency_traces; // member keys of the combo this record fires
+#endif
 } queued_record_t;
 static uint8_t         key_buffer_size = 0;
 static queued_record_t key_buffer[COMBO_KEY_BUFFER_LENGTH];
@@ -102,6 +109,126 @@ static queued_combo_t combo_buffer[COMBO_BUFFER_LENGTH];
 
 #define INCREMENT_MOD(i) i = (i + 1) % COMBO_BUFFER_LENGTH
 
+#ifdef COMBO_LOOKUP_INDEX_SIZE
+/* Keycode to combo lookup, built from the combo definitions on first use so
+ * that only the combos containing a key are visited. Entries are sorted by
+ * keycode, then combo index, keeping the processing order of a linear scan.
+ *
+ * Every distinct combo keycode also gets a compact key id, its position in
+ * combo_key_codes. Combo membership and the combo keys held down are bitsets
+ * over those ids, so overlap checks and state resets don't walk key lists.
+ * With more distinct combo keycodes than COMBO_KEY_IDS only the bitsets are
+ * given up, the keycode lookup is still used. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+} combo_lookup_entry_t;
+static combo_lookup_entry_t combo_lookup[COMBO_LOOKUP_INDEX_SIZE];
+static uint16_t             combo_lookup_size = 0;
+static enum { COMBO_LOOKUP_STALE, COMBO_LOOKUP_VALID, COMBO_LOOKUP_NO_KEY_IDS, COMBO_LOOKUP_OVERFLOW } combo_lookup_state = COMBO_LOOKUP_STALE;
+
+static uint16_t         combo_key_codes[COMBO_KEY_IDS];
+static uint16_t         combo_key_start[COMBO_KEY_IDS + 1];
+static uint8_t          combo_key_count    = 0;
+static combo_key_mask_t combo_keys_down    = 0;
+static combo_key_mask_t combo_keys_touched = 0; // keys pressed since the last clear_combos()
+
+#    define COMBO_KEY_MASK(key_id) ((combo_key_mask_t)1 << (key_id))
+#    if COMBO_KEY_IDS > 32
+#        define COMBO_KEY_POPCOUNT(mask) __builtin_popcountll(mask)
+#        define COMBO_KEY_LOWEST(mask) __builtin_ctzll(mask)
+#    else
+#        define COMBO_KEY_POPCOUNT(mask) __builtin_popcountl(mask)
+#        define COMBO_KEY_LOWEST(mask) __builtin_ctzl(mask)
+#    endif
+
+bool combo_lookup_index_build(void) {
+    combo_lookup_size  = 0;
+    combo_key_count    = 0;
+    combo_keys_down    = 0;
+    combo_keys_touched = 0;
+    combo_lookup_state = COMBO_LOOKUP_OVERFLOW;
+
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        const uint16_t *keys = combo_get(idx)->keys;
+        uint16_t        keycode;
+
+        for (uint8_t key_index = 0; (keycode = pgm_read_word(&keys[key_index])) != COMBO_END; ++key_index) {
+            if (combo_lookup_size >= COMBO_LOOKUP_INDEX_SIZE) {
+                dprintf("combo: lookup index full, using linear scan\n");
+                return false;
+            }
+
+            // Insertion sort, stable so combos sharing a keycode stay in index order
+            uint16_t pos = combo_lookup_size;
+            while (pos > 0 && combo_lookup[pos - 1].keycode > keycode) {
+                combo_lookup[pos] = combo_lookup[pos - 1];
+                pos--;
+            }
+            combo_lookup[pos] = (combo_lookup_entry_t){.keycode = keycode, .combo_index = idx};
+            combo_lookup_size++;
+
+            // A keycode listed twice in one combo must only be processed once
+            if (pos > 0 && combo_lookup[pos - 1].keycode == keycode && combo_lookup[pos - 1].combo_index == idx) {
+                combo_lookup_size--;
+                for (; pos < combo_lookup_size; pos++) {
+                    combo_lookup[pos] = combo_lookup[pos + 1];
+                }
+            }
+        }
+        combo_get(idx)->members = 0;
+    }
+
+    // Assign key ids in keycode order and record each combo's members
+    for (uint16_t i = 0; i < combo_lookup_size; i++) {
+        if (i == 0 || combo_lookup[i].keycode != combo_lookup[i - 1].keycode) {
+            if (combo_key_count >= COMBO_KEY_IDS) {
+                dprintf("combo: more than %u combo keycodes, not using key id bitsets\n", COMBO_KEY_IDS);
+                combo_key_count    = 0;
+                combo_lookup_state = COMBO_LOOKUP_NO_KEY_IDS;
+                return true;
+            }
+            combo_key_codes[combo_key_count] = combo_lookup[i].keycode;
+            combo_key_start[combo_key_count] = i;
+            combo_key_count++;
+        }
+        combo_get(combo_lookup[i].combo_index)->members |= COMBO_KEY_MASK(combo_key_count - 1);
+    }
+    combo_key_start[combo_key_count] = combo_lookup_size;
+
+    combo_lookup_state = COMBO_LOOKUP_VALID;
+    return true;
+}
+
+/* Key id of keycode, or COMBO_KEY_IDS if no combo uses it. */
+static uint8_t combo_key_id(uint16_t keycode) {
+    uint8_t low = 0, high = combo_key_count;
+    while (low < high) {
+        uint8_t mid = low + (high - low) / 2;
+        if (combo_key_codes[mid] < keycode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return (low < combo_key_count && combo_key_codes[low] == keycode) ? low : COMBO_KEY_IDS;
+}
+
+/* Position of the first lookup entry for keycode, or of the next larger keycode if none. */
+static uint16_t combo_lookup_find(uint16_t keycode) {
+    uint16_t low = 0, high = combo_lookup_size;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (combo_lookup[mid].keycode < keycode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+#endif
+
 #ifndef EXTRA_SHORT_COMBOS
 /* flags are their own elements in combo_t struct. */
 #    define COMBO_ACTIVE(combo) (combo->active)
@@ -202,6 +329,22 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
 void clear_combos(void) {
     uint16_t index = 0;
     longest_term   = 0;
+#ifdef COMBO_LOOKUP_INDEX_SIZE
+    if (combo_lookup_state == COMBO_LOOKUP_VALID) {
+        // Only combos containing a key pressed since the last clear can hold any state
+        for (combo_key_mask_t touched = combo_keys_touched; touched; touched &= touched - 1) {
+            uint8_t key_id = COMBO_KEY_LOWEST(touched);
+            for (index = combo_key_start[key_id]; index < combo_key_start[key_id + 1]; ++index) {
+                combo_t *combo = combo_get(combo_lookup[index].combo_index);
+                if (!COMBO_ACTIVE(combo)) {
+                    RESET_COMBO_STATE(combo);
+                }
+            }
+        }
+        combo_keys_touched = combo_keys_down;
+        return;
+    }
+#endif
     for (index = 0; index < combo_count(); ++index) {
         combo_t *combo = combo_get(index);
         if (!COMBO_ACTIVE(combo)) {
@@ -231,6 +374,10 @@ static inline void dump_key_buffer(void) {
             continue;
         }
 
+#ifdef LATENCY_TRACE_ENABLE
+        // The member keys of a combo are measured until the combo's own report, if it sends one
+        latency_trace_dispatch_set(qrecord->latency_traces);
+#endif
         if (!record->keycode && qrecord->combo_index != (uint16_t)-1) {
             process_combo_event(qrecord->combo_index, true);
         } else {
@@ -240,6 +387,9 @@ static inline void dump_key_buffer(void) {
             process_record(record);
 #endif
         }
+#ifdef LATENCY_TRACE_ENABLE
+        latency_trace_settle_set(qrecord->latency_traces);
+#endif
         record->event.type = TICK_EVENT;
 
 #if defined(CAPS_WORD_ENABLE) && defined(AUTO_SHIFT_ENABLE)
@@ -322,6 +472,9 @@ void apply_combo(uint16_t combo_index, combo_t *combo) {
 #else
     uint8_t state = 0;
 #endif
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_set_t latency_traces = 0;
+#endif
 
     for (uint8_t key_buffer_i = 0; key_buffer_i < key_buffer_size; key_buffer_i++) {
         queued_record_t *qrecord = &key_buffer[key_buffer_i];
@@ -338,6 +491,9 @@ void apply_combo(uint16_t combo_index, combo_t *combo) {
         }
 
         KEY_STATE_DOWN(state, key_index);
+#ifdef LATENCY_TRACE_ENABLE
+        latency_traces |= latency_trace_claim(record->event);
+#endif
         if (ALL_COMBO_KEYS_ARE_DOWN(state, key_count)) {
             // this in the end executes the combo when the key_buffer is dumped.
             record->keycode    = combo->keycode;
@@ -345,6 +501,9 @@ void apply_combo(uint16_t combo_index, combo_t *combo) {
             record->event.key  = MAKE_KEYPOS(0, 0);
 
             qrecord->combo_index = combo_index;
+#ifdef LATENCY_TRACE_ENABLE
+            qrecord->latency_traces = latency_traces;
+#endif
             ACTIVATE_COMBO(combo);
 
             break;
@@ -382,6 +541,14 @@ combo_t *overlaps(combo_t *combo1, combo_t *combo2) {
      * The combo that has less keys will be dropped. If they have the same
      * amount of keys, drop combo1. */
 
+#ifdef COMBO_LOOKUP_INDEX_SIZE
+    if (combo_lookup_state == COMBO_LOOKUP_VALID) {
+        if (!(combo1->members & combo2->members)) return NULL;
+        if (COMBO_KEY_POPCOUNT(combo2->members) < COMBO_KEY_POPCOUNT(combo1->members)) return combo2;
+        return combo1;
+    }
+#endif
+
     uint8_t  idx1 = 0, idx2 = 0;
     uint16_t key1, key2;
     bool     overlaps = false;
@@ -552,8 +719,7 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
 }
 
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    uint8_t is_combo_key          = COMBO_KEY_NOT_PRESSED;
-    bool    no_combo_keys_pressed = true;
+    uint8_t is_combo_key = COMBO_KEY_NOT_PRESSED;
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -581,10 +747,44 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_LOOKUP_INDEX_SIZE
+    if (combo_lookup_state == COMBO_LOOKUP_STALE) {
+        combo_lookup_index_build();
+    }
+    if (combo_lookup_state != COMBO_LOOKUP_OVERFLOW) {
+        uint16_t start = 0, end = 0;
+
+        if (combo_lookup_state == COMBO_LOOKUP_VALID) {
+            uint8_t key_id = combo_key_id(keycode);
+            if (key_id < COMBO_KEY_IDS) {
+                if (record->event.pressed) {
+                    combo_keys_down |= COMBO_KEY_MASK(key_id);
+                    combo_keys_touched |= COMBO_KEY_MASK(key_id);
+                } else {
+                    combo_keys_down &= ~COMBO_KEY_MASK(key_id);
+                }
+                start = combo_key_start[key_id];
+                end   = combo_key_start[key_id + 1];
+            }
+        } else {
+            start = end = combo_lookup_find(keycode);
+            while (end < combo_lookup_size && combo_lookup[end].keycode == keycode) {
+                end++;
+            }
+        }
+
+        // Combos not containing the keycode are left untouched by process_single_combo, skip them
+        for (uint16_t i = start; i < end; ++i) {
+            uint16_t idx = combo_lookup[i].combo_index;
+            is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -609,6 +809,9 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
                     .keycode     = keycode,
                     .combo_index = -1, // this will be set when applying combos
                 };
+#ifdef LATENCY_TRACE_ENABLE
+                latency_trace_hold(record->event, LATENCY_TRACE_COMBO);
+#endif
             }
         }
     } else {
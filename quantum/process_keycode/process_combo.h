@@ -39,9 +39,25 @@
 #    define COMBO_BUFFER_LENGTH 4
 #endif
 
+#ifdef COMBO_LOOKUP_INDEX_SIZE
+#    ifndef COMBO_KEY_IDS
+#        define COMBO_KEY_IDS 32
+#    endif
+#    if COMBO_KEY_IDS > 64
+#        error "COMBO_KEY_IDS must be at most 64"
+#    elif COMBO_KEY_IDS > 32
+typedef uint64_t combo_key_mask_t;
+#    else
+typedef uint32_t combo_key_mask_t;
+#    endif
+#endif
+
 typedef struct combo_t {
     const uint16_t *keys;
     uint16_t        keycode;
+#ifdef COMBO_LOOKUP_INDEX_SIZE
+    combo_key_mask_t members; // key ids of the combo's keys, filled in by combo_lookup_index_build()
+#endif
 #ifdef EXTRA_SHORT_COMBOS
     uint8_t state;
 #else
@@ -77,6 +93,10 @@ bool process_combo(uint16_t keycode, keyrecord_t *record);
 void combo_task(void);
 void process_combo_event(uint16_t combo_index, bool pressed);
 
+#ifdef COMBO_LOOKUP_INDEX_SIZE
+bool combo_lookup_index_build(void);
+#endif
+
 void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
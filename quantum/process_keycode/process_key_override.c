@@ -84,6 +84,134 @@ static uint16_t deferred_register = 0;
 // TODO: in future maybe save in EEPROM?
 static bool enabled = true;
 
+#ifdef KEY_OVERRIDE_LOOKUP_INDEX_SIZE
+// Trigger keycode to key override lookup, built from the key overrides on first use so that only the overrides that can activate for an event are checked. Entries are sorted by trigger, then override index. Mod-only overrides (trigger KC_NO) sort first.
+typedef struct {
+    uint16_t trigger;
+    uint16_t override_index;
+} key_override_lookup_entry_t;
+static key_override_lookup_entry_t key_override_lookup[KEY_OVERRIDE_LOOKUP_INDEX_SIZE];
+static uint16_t                    key_override_lookup_size = 0;
+static enum { KEY_OVERRIDE_LOOKUP_STALE, KEY_OVERRIDE_LOOKUP_VALID, KEY_OVERRIDE_LOOKUP_OVERFLOW } key_override_lookup_state = KEY_OVERRIDE_LOOKUP_STALE;
+
+bool key_override_lookup_index_build(void) {
+    key_override_lookup_size  = 0;
+    key_override_lookup_state = KEY_OVERRIDE_LOOKUP_OVERFLOW;
+
+    for (uint16_t i = 0; i < key_override_count(); i++) {
+        const key_override_t *const override = key_override_get(i);
+
+        // End of array
+        if (override == NULL) {
+            break;
+        }
+
+        if (key_override_lookup_size >= KEY_OVERRIDE_LOOKUP_INDEX_SIZE) {
+            dprintf("key override: lookup index full, checking all overrides\n");
+            return false;
+        }
+
+        // Insertion sort, stable so overrides sharing a trigger stay in index order
+        uint16_t pos = key_override_lookup_size;
+        while (pos > 0 && key_override_lookup[pos - 1].trigger > override->trigger) {
+            key_override_lookup[pos] = key_override_lookup[pos - 1];
+            pos--;
+        }
+        key_override_lookup[pos] = (key_override_lookup_entry_t){.trigger = override->trigger, .override_index = i};
+        key_override_lookup_size++;
+    }
+
+    key_override_lookup_state = KEY_OVERRIDE_LOOKUP_VALID;
+    return true;
+}
+
+// Position of the first entry for trigger, or key_override_lookup_size.
+static uint16_t key_override_lookup_find(uint16_t trigger) {
+    uint16_t low = 0, high = key_override_lookup_size;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (key_override_lookup[mid].trigger < trigger) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+#endif
+
+// Walks the key overrides that may activate for an event, in override order.
+typedef struct {
+    bool indexed;
+#ifdef KEY_OVERRIDE_LOOKUP_INDEX_SIZE
+    // Lookup ranges of the event keycode, the last key down and the mod-only overrides
+    uint16_t pos[3];
+    uint16_t end[3];
+#endif
+} key_override_cursor_t;
+
+#ifdef KEY_OVERRIDE_LOOKUP_INDEX_SIZE
+static void key_override_cursor_range(key_override_cursor_t *cursor, uint8_t range, uint16_t trigger) {
+    uint16_t pos = key_override_lookup_find(trigger);
+    uint16_t end = pos;
+    while (end < key_override_lookup_size && key_override_lookup[end].trigger == trigger) {
+        end++;
+    }
+    cursor->pos[range] = pos;
+    cursor->end[range] = end;
+}
+
+static uint16_t key_override_cursor_next_indexed(key_override_cursor_t *cursor) {
+    uint8_t  next_range = 0;
+    uint16_t next       = UINT16_MAX;
+    for (uint8_t range = 0; range < 3; range++) {
+        if (cursor->pos[range] < cursor->end[range] && key_override_lookup[cursor->pos[range]].override_index < next) {
+            next       = key_override_lookup[cursor->pos[range]].override_index;
+            next_range = range;
+        }
+    }
+    if (next != UINT16_MAX) {
+        cursor->pos[next_range]++;
+    }
+    return next;
+}
+#endif
+
+/** Returns the index of the first key override to check for an event on `keycode`. Past the end of the key overrides if there is none. */
+static uint16_t key_override_cursor_first(key_override_cursor_t *cursor, const uint16_t keycode) {
+#ifdef KEY_OVERRIDE_LOOKUP_INDEX_SIZE
+    if (key_override_lookup_state == KEY_OVERRIDE_LOOKUP_STALE) {
+        key_override_lookup_index_build();
+    }
+    cursor->indexed = key_override_lookup_state == KEY_OVERRIDE_LOOKUP_VALID;
+    if (cursor->indexed) {
+        // An override can only activate if its trigger was just pressed, is the last key that is down, or if it has no trigger
+        key_override_cursor_range(cursor, 0, KC_NO);
+        key_override_cursor_range(cursor, 1, keycode);
+        key_override_cursor_range(cursor, 2, last_key_down);
+        if (keycode == KC_NO) {
+            cursor->end[1] = cursor->pos[1];
+        }
+        if (last_key_down == KC_NO || last_key_down == keycode) {
+            cursor->end[2] = cursor->pos[2];
+        }
+        return key_override_cursor_next_indexed(cursor);
+    }
+#endif
+    cursor->indexed = false;
+    return 0;
+}
+
+/** Returns the index of the key override to check after `index`. */
+static uint16_t key_override_cursor_next(key_override_cursor_t *cursor, const uint16_t index) {
+#ifdef KEY_OVERRIDE_LOOKUP_INDEX_SIZE
+    if (cursor->indexed) {
+        return key_override_cursor_next_indexed(cursor);
+    }
+#endif
+    return index + 1;
+}
+
 // Forward decls
 static const key_override_t *clear_active_override(const bool allow_reregister);
 
@@ -249,7 +377,9 @@ static bool try_activating_override(const uint16_t keycode, const uint8_t layer,
         return true;
     }
 
-    for (uint8_t i = 0; i < key_override_count(); i++) {
+    key_override_cursor_t cursor;
+
+    for (uint16_t i = key_override_cursor_first(&cursor, keycode); i < key_override_count(); i = key_override_cursor_next(&cursor, i)) {
         const key_override_t *const override = key_override_get(i);
 
         // End of array
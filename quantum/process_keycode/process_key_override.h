@@ -99,6 +99,11 @@ void key_override_toggle(void);
 /** Returns whether key overrides are enabled */
 bool key_override_is_enabled(void);
 
+#ifdef KEY_OVERRIDE_LOOKUP_INDEX_SIZE
+/** Rebuilds the trigger keycode lookup index, call after changing the key overrides at runtime. Returns false if they don't fit and all overrides are checked instead. */
+bool key_override_lookup_index_build(void);
+#endif
+
 /** Handling of key overrides and its implemented keycodes */
 bool process_key_override(const uint16_t keycode, const keyrecord_t *const record);
 
@@ -0,0 +1,237 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "profiling.h"
+#include "timer.h"
+#include "debug.h"
+#include "print.h"
+
+#ifndef PROFILING_CONSOLE_INTERVAL
+#    ifdef CONSOLE_ENABLE
+#        define PROFILING_CONSOLE_INTERVAL 5000
+#    else
+#        define PROFILING_CONSOLE_INTERVAL 0
+#    endif
+#endif
+
+typedef struct {
+    const char *name;
+    uint32_t    count;
+    uint32_t    min;
+    uint32_t    max;
+    uint64_t    total;
+    uint16_t    histogram[PROFILING_HISTOGRAM_BUCKETS];
+} profiling_probe_t;
+
+static profiling_probe_t probes[PROFILING_MAX_PROBES] = {
+    [PROFILING_PROBE_MATRIX_TASK]        = {.name = "matrix_task", .min = UINT32_MAX},
+    [PROFILING_PROBE_ACTION_EXEC]        = {.name = "action_exec", .min = UINT32_MAX},
+    [PROFILING_PROBE_RGB_MATRIX_TASK]    = {.name = "rgb_matrix_task", .min = UINT32_MAX},
+    [PROFILING_PROBE_HOUSEKEEPING_TASK]  = {.name = "housekeeping_task", .min = UINT32_MAX},
+    [PROFILING_PROBE_SPLIT_TRANSACTIONS] = {.name = "split_transactions", .min = UINT32_MAX},
+#ifdef LATENCY_TRACE_ENABLE
+    [PROFILING_PROBE_LATENCY_DIRECT]     = {.name = "latency_direct", .min = UINT32_MAX},
+    [PROFILING_PROBE_LATENCY_TAPPING]    = {.name = "latency_tapping", .min = UINT32_MAX},
+    [PROFILING_PROBE_LATENCY_COMBO]      = {.name = "latency_combo", .min = UINT32_MAX},
+#endif
+};
+static uint8_t probe_count = PROFILING_BUILTIN_PROBES;
+
+/* Log-linear buckets: exact below 4 ticks, then 4 sub-buckets per octave. */
+static uint8_t bucket_index(uint32_t ticks) {
+    if (ticks < 4) {
+        return ticks;
+    }
+    uint8_t msb   = 31 - __builtin_clz(ticks);
+    uint8_t index = 4 * (msb - 1) + ((ticks >> (msb - 2)) & 3);
+    return index < PROFILING_HISTOGRAM_BUCKETS ? index : PROFILING_HISTOGRAM_BUCKETS - 1;
+}
+
+static uint32_t bucket_lower_bound(uint8_t index) {
+    if (index < 4) {
+        return index;
+    }
+    uint8_t msb = index / 4 + 1;
+    return (uint32_t)(4 + (index & 3)) << (msb - 2);
+}
+
+static uint32_t histogram_percentile(const profiling_probe_t *probe, uint8_t percent) {
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < PROFILING_HISTOGRAM_BUCKETS; i++) {
+        total += probe->histogram[i];
+    }
+    uint32_t rank = (total * percent + 99) / 100;
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < PROFILING_HISTOGRAM_BUCKETS - 1; i++) {
+        seen += probe->histogram[i];
+        if (seen >= rank) {
+            uint32_t upper = bucket_lower_bound(i + 1) - 1;
+            if (upper < probe->min) return probe->min;
+            return upper < probe->max ? upper : probe->max;
+        }
+    }
+    return probe->max;
+}
+
+void profiling_init(void) {
+    profiling_clock_init();
+}
+
+uint8_t profiling_probe_register(const char *name) {
+    for (uint8_t i = 0; i < probe_count; i++) {
+        if (strcmp(probes[i].name, name) == 0) {
+            return i;
+        }
+    }
+    if (probe_count >= PROFILING_MAX_PROBES) {
+        dprintf("profiling: no room for probe %s\n", name);
+        return PROFILING_NO_PROBE;
+    }
+    probes[probe_count].name = name;
+    probes[probe_count].min  = UINT32_MAX;
+    return probe_count++;
+}
+
+uint8_t profiling_probe_count(void) {
+    return probe_count;
+}
+
+void profiling_record_ticks(uint8_t probe_id, uint32_t ticks) {
+    if (probe_id >= probe_count) {
+        return;
+    }
+    profiling_probe_t *probe = &probes[probe_id];
+
+    probe->count++;
+    probe->total += ticks;
+    if (ticks < probe->min) probe->min = ticks;
+    if (ticks > probe->max) probe->max = ticks;
+
+    uint8_t index = bucket_index(ticks);
+    if (probe->histogram[index] == UINT16_MAX) {
+        // Halve every bucket rather than saturate, so the shape is preserved
+        for (uint8_t i = 0; i < PROFILING_HISTOGRAM_BUCKETS; i++) {
+            probe->histogram[i] >>= 1;
+        }
+    }
+    probe->histogram[index]++;
+}
+
+void profiling_record(uint8_t probe_id, uint32_t start) {
+    profiling_record_ticks(probe_id, profiling_clock_read() - start);
+}
+
+bool profiling_get_stats(uint8_t probe_id, profiling_stats_t *stats) {
+    if (probe_id >= probe_count) {
+        return false;
+    }
+    const profiling_probe_t *probe = &probes[probe_id];
+
+    memset(stats, 0, sizeof(profiling_stats_t));
+    stats->name  = probe->name;
+    stats->count = probe->count;
+    if (probe->count == 0) {
+        return true;
+    }
+    stats->min_ns  = profiling_clock_ticks_to_ns(probe->min);
+    stats->max_ns  = profiling_clock_ticks_to_ns(probe->max);
+    stats->mean_ns = profiling_clock_ticks_to_ns(probe->total / probe->count);
+    stats->p50_ns  = profiling_clock_ticks_to_ns(histogram_percentile(probe, 50));
+    stats->p99_ns  = profiling_clock_ticks_to_ns(histogram_percentile(probe, 99));
+    return true;
+}
+
+void profiling_reset(void) {
+    for (uint8_t i = 0; i < probe_count; i++) {
+        const char *name = probes[i].name;
+        memset(&probes[i], 0, sizeof(profiling_probe_t));
+        probes[i].name = name;
+        probes[i].min  = UINT32_MAX;
+    }
+}
+
+void profiling_print(void) {
+    profiling_stats_t stats;
+    uprintf("%-20s %10s %10s %10s %10s %10s %10s\n", "probe (ns)", "count", "min", "p50", "p99", "max", "mean");
+    for (uint8_t i = 0; i < probe_count; i++) {
+        profiling_get_stats(i, &stats);
+        if (stats.count == 0) {
+            continue;
+        }
+        uprintf("%-20s %10lu %10lu %10lu %10lu %10lu %10lu\n", stats.name, stats.count, stats.min_ns, stats.p50_ns, stats.p99_ns, stats.max_ns, stats.mean_ns);
+    }
+}
+
+void profiling_task(void) {
+#if PROFILING_CONSOLE_INTERVAL > 0
+    static uint32_t last_print = 0;
+    if (timer_elapsed32(last_print) >= PROFILING_CONSOLE_INTERVAL) {
+        last_print = timer_read32();
+        if (debug_enable) {
+            profiling_print();
+        }
+    }
+#endif
+}
+
+static void write_u32(uint8_t *dest, uint32_t value) {
+    dest[0] = value & 0xFF;
+    dest[1] = (value >> 8) & 0xFF;
+    dest[2] = (value >> 16) & 0xFF;
+    dest[3] = (value >> 24) & 0xFF;
+}
+
+bool profiling_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 3 || data[0] != PROFILING_RAW_HID_ID) {
+        return false;
+    }
+
+    uint8_t *command_id   = &data[1];
+    uint8_t *command_data = &data[2];
+    switch (*command_id) {
+        case profiling_raw_hid_get_probe_count: {
+            command_data[0] = probe_count;
+            break;
+        }
+        case profiling_raw_hid_get_probe_stats: {
+            // [probe, count, min, max, mean, p50, p99] as little-endian u32 nanoseconds
+            profiling_stats_t stats;
+            if (length < 3 + 6 * sizeof(uint32_t) || !profiling_get_stats(command_data[0], &stats)) {
+                *command_id = profiling_raw_hid_unhandled;
+                break;
+            }
+            write_u32(&command_data[1], stats.count);
+            write_u32(&command_data[5], stats.min_ns);
+            write_u32(&command_data[9], stats.max_ns);
+            write_u32(&command_data[13], stats.mean_ns);
+            write_u32(&command_data[17], stats.p50_ns);
+            write_u32(&command_data[21], stats.p99_ns);
+            break;
+        }
+        case profiling_raw_hid_get_probe_name: {
+            // [probe, name...] with the name truncated to fit and always terminated
+            if (length < 4 || command_data[0] >= probe_count) {
+                *command_id = profiling_raw_hid_unhandled;
+                break;
+            }
+            uint8_t max_length = length - 3 - 1;
+            strncpy((char *)&command_data[1], probes[command_data[0]].name, max_length);
+            command_data[1 + max_length] = 0;
+            break;
+        }
+        case profiling_raw_hid_reset: {
+            profiling_reset();
+            break;
+        }
+        default: {
+            *command_id = profiling_raw_hid_unhandled;
+            break;
+        }
+    }
+    return true;
+}
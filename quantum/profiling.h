@@ -0,0 +1,137 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Hot-path timing probes, kept in a fixed RAM table.
+
+    Each probe records count, min, max, mean and a log-linear histogram of its
+    durations, from which p50/p99 are derived. Durations are measured with the
+    platform cycle counter (DWT on ChibiOS ARMv7-M, the host monotonic clock on
+    the test platform) and reported in nanoseconds.
+
+    Usage example:
+
+        #include "profiling.h"
+
+        // Time a call, the probe is registered on first use:
+        PROBE_CALL("my_task", my_task());
+
+        // Time an arbitrary region against a registered probe:
+        static uint8_t my_probe = PROFILING_NO_PROBE;
+        if (my_probe == PROFILING_NO_PROBE) my_probe = profiling_probe_register("my_region");
+
+        PROBE_BEGIN(my_probe);
+        ...
+        PROBE_END(my_probe);
+
+    Without PROFILING_ENABLE all of the above compile down to the bare call.
+*/
+
+#ifndef PROFILING_USER_PROBES
+#    define PROFILING_USER_PROBES 4
+#endif
+
+#ifndef PROFILING_HISTOGRAM_BUCKETS
+#    define PROFILING_HISTOGRAM_BUCKETS 64
+#endif
+
+#if PROFILING_HISTOGRAM_BUCKETS < 8 || PROFILING_HISTOGRAM_BUCKETS > 128
+#    error "PROFILING_HISTOGRAM_BUCKETS must be between 8 and 128"
+#endif
+
+#ifndef PROFILING_RAW_HID_ID
+#    define PROFILING_RAW_HID_ID 0xFD
+#endif
+
+#define PROFILING_NO_PROBE 0xFF
+
+enum profiling_builtin_probes {
+    PROFILING_PROBE_MATRIX_TASK,
+    PROFILING_PROBE_ACTION_EXEC,
+    PROFILING_PROBE_RGB_MATRIX_TASK,
+    PROFILING_PROBE_HOUSEKEEPING_TASK,
+    PROFILING_PROBE_SPLIT_TRANSACTIONS,
+#ifdef LATENCY_TRACE_ENABLE
+    PROFILING_PROBE_LATENCY_DIRECT,
+    PROFILING_PROBE_LATENCY_TAPPING,
+    PROFILING_PROBE_LATENCY_COMBO,
+#endif
+    PROFILING_BUILTIN_PROBES,
+};
+
+#define PROFILING_MAX_PROBES (PROFILING_BUILTIN_PROBES + PROFILING_USER_PROBES)
+
+enum profiling_raw_hid_commands {
+    profiling_raw_hid_get_probe_count = 0x01,
+    profiling_raw_hid_get_probe_stats = 0x02,
+    profiling_raw_hid_get_probe_name  = 0x03,
+    profiling_raw_hid_reset           = 0x04,
+    profiling_raw_hid_unhandled       = 0xFF,
+};
+
+typedef struct {
+    const char *name;
+    uint32_t    count;
+    uint32_t    min_ns;
+    uint32_t    max_ns;
+    uint32_t    mean_ns;
+    uint32_t    p50_ns;
+    uint32_t    p99_ns;
+} profiling_stats_t;
+
+/* Platform clock, implemented in platforms/<platform>/profiling_clock.c */
+void     profiling_clock_init(void);
+uint32_t profiling_clock_read(void);
+uint32_t profiling_clock_ticks_to_ns(uint32_t ticks);
+
+void    profiling_init(void);
+void    profiling_task(void);
+uint8_t profiling_probe_register(const char *name);
+uint8_t profiling_probe_count(void);
+void    profiling_record(uint8_t probe, uint32_t start);
+void    profiling_record_ticks(uint8_t probe, uint32_t ticks);
+bool    profiling_get_stats(uint8_t probe, profiling_stats_t *stats);
+void    profiling_reset(void);
+void    profiling_print(void);
+
+/**
+ * \brief Handle a profiling query received over raw HID.
+ *
+ * Call from `raw_hid_receive()` (or `raw_hid_receive_kb()` with VIA). The
+ * response is written back into `data`, ready to be passed to `raw_hid_send()`.
+ *
+ * \return true if the packet was a profiling query
+ */
+bool profiling_raw_hid_receive(uint8_t *data, uint8_t length);
+
+#ifdef PROFILING_ENABLE
+#    define PROBE_BEGIN(probe) const uint32_t profiling_start_##probe = profiling_clock_read()
+#    define PROBE_END(probe) profiling_record((probe), profiling_start_##probe)
+#    define PROBE_CALL(name, call)                                 \
+        do {                                                       \
+            static uint8_t probe_id = PROFILING_NO_PROBE;          \
+            if (probe_id == PROFILING_NO_PROBE) {                  \
+                probe_id = profiling_probe_register(name);         \
+            }                                                      \
+            const uint32_t probe_start = profiling_clock_read();   \
+            do {                                                   \
+                call;                                              \
+            } while (0);                                           \
+            profiling_record(probe_id, probe_start);               \
+        } while (0)
+#else
+#    define PROBE_BEGIN(probe) \
+        do {                   \
+        } while (0)
+#    define PROBE_END(probe) \
+        do {                 \
+        } while (0)
+#    define PROBE_CALL(name, call) \
+        do {                       \
+            call;                  \
+        } while (0)
+#endif
@@ -11,6 +11,18 @@
 #    define RGB_MATRIX_FRAMEBUFFER_EFFECTS
 #endif
 
+// geometry table
+#if defined(ENABLE_RGB_MATRIX_BAND_PINWHEEL_SAT) || \
+    defined(ENABLE_RGB_MATRIX_BAND_PINWHEEL_VAL) || \
+    defined(ENABLE_RGB_MATRIX_BAND_SPIRAL_SAT) || \
+    defined(ENABLE_RGB_MATRIX_BAND_SPIRAL_VAL) || \
+    defined(ENABLE_RGB_MATRIX_CYCLE_OUT_IN) || \
+    defined(ENABLE_RGB_MATRIX_CYCLE_OUT_IN_DUAL) || \
+    defined(ENABLE_RGB_MATRIX_CYCLE_PINWHEEL) || \
+    defined(ENABLE_RGB_MATRIX_CYCLE_SPIRAL)
+#    define RGB_MATRIX_GEOMETRY_TABLE
+#endif
+
 // reactive
 #if defined(ENABLE_RGB_MATRIX_SOLID_REACTIVE_SIMPLE) || \
     defined(ENABLE_RGB_MATRIX_SOLID_REACTIVE) || \
@@ -39,6 +39,151 @@ __attribute__((weak)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
     return hsv_to_rgb(hsv);
 }
 
+#ifdef RGB_MATRIX_HSV_BATCH
+// Keyboards overriding rgb_matrix_hsv_to_rgb() need to override this too
+__attribute__((weak)) void rgb_matrix_hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+    hsv_to_rgb_batch(hsv, rgb, count);
+}
+#endif
+
+static led_geometry_t rgb_matrix_compute_led_geometry(uint8_t i) {
+    int16_t dx = g_led_config.point[i].x - k_rgb_matrix_center.x;
+    int16_t dy = g_led_config.point[i].y - k_rgb_matrix_center.y;
+    return (led_geometry_t){dx, dy, sqrt16(dx * dx + dy * dy), atan2_8(dy, dx)};
+}
+
+#ifdef RGB_MATRIX_GEOMETRY_TABLE
+static bool rgb_matrix_geometry_valid = false;
+
+/*
+ * The generated geometry table is only used if it matches g_led_config and
+ * k_rgb_matrix_center, which a keyboard or keymap may have overridden.
+ */
+static void rgb_matrix_geometry_init(void) {
+    rgb_matrix_geometry_valid = false;
+    if (!g_rgb_matrix_geometry) {
+        return;
+    }
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        led_geometry_t expected = rgb_matrix_compute_led_geometry(i);
+        led_geometry_t geometry;
+        memcpy_P(&geometry, &g_rgb_matrix_geometry[i], sizeof(geometry));
+        if (memcmp(&geometry, &expected, sizeof(geometry)) != 0) {
+            dprintf("rgb_matrix: geometry table does not match LED %u, computing it per frame\n", i);
+            return;
+        }
+    }
+    rgb_matrix_geometry_valid = true;
+}
+#endif
+
+/*
+ * Offset, distance and angle of an LED from the center, read from the
+ * generated table instead of computing them on every frame where possible.
+ */
+static inline led_geometry_t rgb_matrix_led_geometry(uint8_t i) {
+#ifdef RGB_MATRIX_GEOMETRY_TABLE
+    if (rgb_matrix_geometry_valid) {
+        led_geometry_t geometry;
+        memcpy_P(&geometry, &g_rgb_matrix_geometry[i], sizeof(geometry));
+        return geometry;
+    }
+#endif
+    return rgb_matrix_compute_led_geometry(i);
+}
+
+#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+#    ifdef RGB_MATRIX_SPLASH_DISTANCE_TABLE
+static bool rgb_matrix_distance_valid = false;
+
+// Index of the distance between LEDs a and b, a > b, in the triangular g_rgb_matrix_distance table
+static inline uint16_t rgb_matrix_distance_index(uint8_t a, uint8_t b) {
+    return (uint16_t)a * (a - 1) / 2 + b;
+}
+
+static void rgb_matrix_distance_init(void) {
+    rgb_matrix_distance_valid = false;
+    if (!g_rgb_matrix_distance) {
+        return;
+    }
+    for (uint8_t a = 1; a < RGB_MATRIX_LED_COUNT; a++) {
+        for (uint8_t b = 0; b < a; b++) {
+            int16_t dx = g_led_config.point[a].x - g_led_config.point[b].x;
+            int16_t dy = g_led_config.point[a].y - g_led_config.point[b].y;
+            if (pgm_read_byte(&g_rgb_matrix_distance[rgb_matrix_distance_index(a, b)]) != sqrt16(dx * dx + dy * dy)) {
+                dprintf("rgb_matrix: distance table does not match LEDs %u and %u, computing it per frame\n", a, b);
+                return;
+            }
+        }
+    }
+    rgb_matrix_distance_valid = true;
+}
+#    endif
+
+/*
+ * Distance between LED i and the LED at dx, dy from it, which has index
+ * `other`, read from the generated table where possible.
+ */
+static inline uint8_t rgb_matrix_led_distance(uint8_t i, uint8_t other, int16_t dx, int16_t dy) {
+#    ifdef RGB_MATRIX_SPLASH_DISTANCE_TABLE
+    if (rgb_matrix_distance_valid && other < RGB_MATRIX_LED_COUNT) {
+        if (i == other) {
+            return 0;
+        }
+        return pgm_read_byte(&g_rgb_matrix_distance[i > other ? rgb_matrix_distance_index(i, other) : rgb_matrix_distance_index(other, i)]);
+    }
+#    endif
+    return sqrt16(dx * dx + dy * dy);
+}
+#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+
+#ifdef RGB_MATRIX_HSV_BATCH
+/*
+ * The effect runners collect the colors of up to RGB_MATRIX_HSV_BATCH_SIZE
+ * LEDs in HSV, and convert them to RGB in one go.
+ */
+typedef struct {
+    uint8_t count;
+    uint8_t index[RGB_MATRIX_HSV_BATCH_SIZE];
+    union {
+        hsv_t hsv[RGB_MATRIX_HSV_BATCH_SIZE];
+        rgb_t rgb[RGB_MATRIX_HSV_BATCH_SIZE];
+    };
+} rgb_matrix_hsv_batch_t;
+
+#    define RGB_MATRIX_USE_HSV_BATCH(batch) \
+        rgb_matrix_hsv_batch_t batch;       \
+        batch.count = 0
+
+static void rgb_matrix_hsv_batch_flush(rgb_matrix_hsv_batch_t *batch) {
+    rgb_matrix_hsv_to_rgb_batch(batch->hsv, batch->rgb, batch->count);
+    for (uint8_t n = 0; n < batch->count; n++) {
+        rgb_matrix_set_color(batch->index[n], batch->rgb[n].r, batch->rgb[n].g, batch->rgb[n].b);
+    }
+    batch->count = 0;
+}
+
+static inline void rgb_matrix_hsv_batch_set(rgb_matrix_hsv_batch_t *batch, uint8_t i, hsv_t hsv) {
+    batch->index[batch->count] = i;
+    batch->hsv[batch->count]   = hsv;
+    if (++batch->count == RGB_MATRIX_HSV_BATCH_SIZE) {
+        rgb_matrix_hsv_batch_flush(batch);
+    }
+}
+#else
+// Without RGB_MATRIX_HSV_BATCH each color is converted and set right away, there is no buffer
+typedef uint8_t rgb_matrix_hsv_batch_t;
+
+#    define RGB_MATRIX_USE_HSV_BATCH(batch) rgb_matrix_hsv_batch_t batch
+
+static inline void rgb_matrix_hsv_batch_flush(rgb_matrix_hsv_batch_t *batch) {}
+
+static inline void rgb_matrix_hsv_batch_set(rgb_matrix_hsv_batch_t *batch, uint8_t i, hsv_t hsv) {
+    rgb_t rgb = rgb_matrix_hsv_to_rgb(hsv);
+    rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+}
+#endif
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
@@ -359,6 +504,17 @@ static void rgb_task_flush(uint8_t effect) {
     rgb_task_state = SYNCING;
 }
 
+#ifdef RGB_MATRIX_INCREMENTAL_FLUSH
+// Flush one part of the changes per task run, so that a flush does not hold up
+// the scan for longer than a single bus transfer.
+static void rgb_task_flush_step(uint8_t effect) {
+    if (rgb_matrix_driver.flush_step && rgb_matrix_driver.flush_step()) {
+        return;
+    }
+    rgb_task_flush(effect);
+}
+#endif
+
 void rgb_matrix_task(void) {
     rgb_task_timers();
 
@@ -386,7 +542,11 @@ void rgb_matrix_task(void) {
             }
             break;
         case FLUSHING:
+#ifdef RGB_MATRIX_INCREMENTAL_FLUSH
+            rgb_task_flush_step(effect);
+#else
             rgb_task_flush(effect);
+#endif
             break;
         case SYNCING:
             rgb_task_sync();
@@ -467,6 +627,13 @@ void rgb_matrix_init(void) {
     }
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
+#ifdef RGB_MATRIX_GEOMETRY_TABLE
+    rgb_matrix_geometry_init();
+#endif
+#if defined(RGB_MATRIX_KEYREACTIVE_ENABLED) && defined(RGB_MATRIX_SPLASH_DISTANCE_TABLE)
+    rgb_matrix_distance_init();
+#endif
+
     eeconfig_init_rgb_matrix();
     if (!rgb_matrix_config.mode) {
         dprintf("rgb_matrix_init_drivers rgb_matrix_config.mode = 0. Write default values to EEPROM.\n");
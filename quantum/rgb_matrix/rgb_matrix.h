@@ -90,6 +90,10 @@
 #    define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
 #endif
 
+#ifndef RGB_MATRIX_HSV_BATCH_SIZE
+#    define RGB_MATRIX_HSV_BATCH_SIZE 16
+#endif
+
 struct rgb_matrix_limits_t {
     uint8_t led_min_index;
     uint8_t led_max_index;
@@ -274,6 +278,14 @@ extern rgb_config_t rgb_matrix_config;
 
 extern uint32_t     g_rgb_timer;
 extern led_config_t g_led_config;
+#ifdef RGB_MATRIX_GEOMETRY_TABLE
+// Generated from info.json when it has an rgb_matrix layout, see rgb_matrix_led_geometry()
+extern const led_geometry_t g_rgb_matrix_geometry[RGB_MATRIX_LED_COUNT] __attribute__((weak));
+#endif
+#if defined(RGB_MATRIX_KEYREACTIVE_ENABLED) && defined(RGB_MATRIX_SPLASH_DISTANCE_TABLE)
+// Generated from info.json, the distance between every two LEDs, see rgb_matrix_led_distance()
+extern const uint8_t g_rgb_matrix_distance[RGB_MATRIX_LED_COUNT * (RGB_MATRIX_LED_COUNT - 1) / 2] __attribute__((weak));
+#endif
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
 #endif
@@ -23,7 +23,7 @@
 
 /* Each driver needs to define the struct
  *    const rgb_matrix_driver_t rgb_matrix_driver;
- * All members must be provided.
+ * All members except flush_step must be provided.
  * Keyboard custom drivers can define this in their own files, it should only
  * be here if shared between boards.
  */
@@ -48,6 +48,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3729_init_drivers,
     .flush         = is31fl3729_flush,
+    .flush_step    = is31fl3729_flush_step,
     .set_color     = is31fl3729_set_color,
     .set_color_all = is31fl3729_set_color_all,
 };
@@ -56,6 +57,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3731_init_drivers,
     .flush         = is31fl3731_flush,
+    .flush_step    = is31fl3731_flush_step,
     .set_color     = is31fl3731_set_color,
     .set_color_all = is31fl3731_set_color_all,
 };
@@ -64,6 +66,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3733_init_drivers,
     .flush         = is31fl3733_flush,
+    .flush_step    = is31fl3733_flush_step,
     .set_color     = is31fl3733_set_color,
     .set_color_all = is31fl3733_set_color_all,
 };
@@ -72,6 +75,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3736_init_drivers,
     .flush         = is31fl3736_flush,
+    .flush_step    = is31fl3736_flush_step,
     .set_color     = is31fl3736_set_color,
     .set_color_all = is31fl3736_set_color_all,
 };
@@ -80,6 +84,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3737_init_drivers,
     .flush         = is31fl3737_flush,
+    .flush_step    = is31fl3737_flush_step,
     .set_color     = is31fl3737_set_color,
     .set_color_all = is31fl3737_set_color_all,
 };
@@ -88,6 +93,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3741_init_drivers,
     .flush         = is31fl3741_flush,
+    .flush_step    = is31fl3741_flush_step,
     .set_color     = is31fl3741_set_color,
     .set_color_all = is31fl3741_set_color_all,
 };
@@ -96,6 +102,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3742a_init_drivers,
     .flush         = is31fl3742a_flush,
+    .flush_step    = is31fl3742a_flush_step,
     .set_color     = is31fl3742a_set_color,
     .set_color_all = is31fl3742a_set_color_all,
 };
@@ -104,6 +111,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3743a_init_drivers,
     .flush         = is31fl3743a_flush,
+    .flush_step    = is31fl3743a_flush_step,
     .set_color     = is31fl3743a_set_color,
     .set_color_all = is31fl3743a_set_color_all,
 };
@@ -112,6 +120,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3745_init_drivers,
     .flush         = is31fl3745_flush,
+    .flush_step    = is31fl3745_flush_step,
     .set_color     = is31fl3745_set_color,
     .set_color_all = is31fl3745_set_color_all,
 };
@@ -120,6 +129,7 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3746a_init_drivers,
     .flush         = is31fl3746a_flush,
+    .flush_step    = is31fl3746a_flush_step,
     .set_color     = is31fl3746a_set_color,
     .set_color_all = is31fl3746a_set_color_all,
 };
@@ -0,0 +1,102 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "test_common.hpp"
+#include "bench.hpp"
+
+// clang-format off
+const uint16_t bench_keymap[][MATRIX_ROWS][MATRIX_COLS] = {
+    {
+        {KC_Q,         KC_W,         KC_E,         KC_R,         KC_T,   KC_Y,    KC_U,         KC_I,         KC_O,         KC_P},
+        {LGUI_T(KC_A), LALT_T(KC_S), LCTL_T(KC_D), LSFT_T(KC_F), KC_G,   KC_H,    RSFT_T(KC_J), RCTL_T(KC_K), RALT_T(KC_L), RGUI_T(KC_SCLN)},
+        {KC_Z,         KC_X,         KC_C,         KC_V,         KC_B,   KC_N,    KC_M,         KC_COMM,      KC_DOT,       KC_SLSH},
+        {KC_LCTL,      QK_LEAD,      CW_TOGG,      TD(0),        KC_SPC, KC_ENT,  KC_BSPC,      KC_LSFT,      KC_MINS,      KC_QUOT},
+    },
+};
+// clang-format on
+
+/* The same prose, misspelt the way the default autocorrect dictionary expects. */
+const char* const typo_prose =
+    "the quick brown fox jumps over the the lazy dog, becuase thier firmware spends most of its time "
+    "waiting for the next key. a fales start, a fitler that is too eager or a cosnt that is not, "
+    "every typo that does arrive has to pass through a long chain of features before it is corrected, "
+    "and the the same chain runs on every press and every release, all day long.";
+
+/* Home row mods, combos, tap dance, key overrides, autocorrect, Caps Word and
+ * leader all enabled at once, as on a typical split keyboard keymap. */
+class AllFeatures : public BenchFixture {
+   protected:
+    AllFeatures() {
+        set_bench_keymap(bench_keymap);
+    }
+
+    /* Holds `modifier` while tapping `keycodes`. */
+    std::vector<TraceEvent> hold_and_type(uint16_t modifier, const std::vector<uint16_t>& keycodes) const {
+        std::vector<TraceEvent> events  = chord({modifier});
+        TraceEvent              release = events.back();
+        events.pop_back();
+        append(events, type_keys(keycodes), 40);
+        release.time = events.back().time + 40;
+        events.push_back(release);
+        return events;
+    }
+};
+
+TEST_F(AllFeatures, prose) {
+    run_bench("prose", type_text(BENCH_PROSE));
+}
+
+TEST_F(AllFeatures, prose_with_typos) {
+    run_bench("prose_with_typos", type_text(typo_prose));
+}
+
+TEST_F(AllFeatures, combos) {
+    const std::vector<std::vector<uint16_t>> chords = {{KC_W, KC_E}, {KC_X, KC_C}, {KC_C, KC_V}, {KC_M, KC_COMM}, {KC_U, KC_I}};
+
+    std::vector<TraceEvent> events;
+    for (unsigned i = 0; i < 20; i++) {
+        append(events, type_text("word "));
+        append(events, chord(chords[i % chords.size()]));
+    }
+    run_bench("combos", events);
+}
+
+TEST_F(AllFeatures, key_overrides) {
+    std::vector<TraceEvent> events;
+    for (unsigned i = 0; i < 20; i++) {
+        append(events, type_text("word"));
+        append(events, hold_and_type(KC_LSFT, {KC_BSPC, KC_BSPC, KC_DOT, KC_COMM}));
+    }
+    run_bench("key_overrides", events);
+}
+
+TEST_F(AllFeatures, caps_word) {
+    std::vector<TraceEvent> events;
+    for (unsigned i = 0; i < 20; i++) {
+        append(events, type_keys({CW_TOGG}));
+        append(events, type_text("qmk-firmware "));
+    }
+    run_bench("caps_word", events);
+}
+
+TEST_F(AllFeatures, leader) {
+    const std::vector<std::vector<uint16_t>> sequences = {{KC_E}, {KC_D, KC_D}, {KC_S, KC_S}, {KC_G, KC_I, KC_T}, {KC_Z}};
+
+    std::vector<TraceEvent> events;
+    for (unsigned i = 0; i < 20; i++) {
+        append(events, type_text("word "), LEADER_TIMEOUT);
+        append(events, type_keys({QK_LEAD}));
+        append(events, type_keys(sequences[i % sequences.size()]));
+    }
+    run_bench("leader", events);
+}
+
+TEST_F(AllFeatures, tap_dance) {
+    std::vector<TraceEvent> events;
+    for (unsigned i = 0; i < 20; i++) {
+        append(events, type_text("word "), TAPPING_TERM);
+        append(events, type_keys(std::vector<uint16_t>(1 + i % 2, TD(0))));
+    }
+    run_bench("tap_dance", events);
+}
@@ -0,0 +1,53 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+const uint16_t PROGMEM we_combo[]      = {KC_W, KC_E, COMBO_END};
+const uint16_t PROGMEM er_combo[]      = {KC_E, KC_R, COMBO_END};
+const uint16_t PROGMEM ui_combo[]      = {KC_U, KC_I, COMBO_END};
+const uint16_t PROGMEM io_combo[]      = {KC_I, KC_O, COMBO_END};
+const uint16_t PROGMEM xc_combo[]      = {KC_X, KC_C, COMBO_END};
+const uint16_t PROGMEM cv_combo[]      = {KC_C, KC_V, COMBO_END};
+const uint16_t PROGMEM mcomm_combo[]   = {KC_M, KC_COMM, COMBO_END};
+const uint16_t PROGMEM commdot_combo[] = {KC_COMM, KC_DOT, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    COMBO(we_combo, KC_ESC),
+    COMBO(er_combo, KC_TAB),
+    COMBO(ui_combo, KC_BSPC),
+    COMBO(io_combo, KC_DEL),
+    COMBO(xc_combo, C(KC_C)),
+    COMBO(cv_combo, C(KC_V)),
+    COMBO(mcomm_combo, KC_ENT),
+    COMBO(commdot_combo, KC_QUES),
+};
+
+tap_dance_action_t tap_dance_actions[] = {
+    ACTION_TAP_DANCE_DOUBLE(KC_LBRC, KC_RBRC),
+};
+
+const key_override_t delete_key_override    = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+const key_override_t semicolon_key_override = ko_make_basic(MOD_MASK_SHIFT, KC_COMM, KC_SCLN);
+const key_override_t colon_key_override     = ko_make_basic(MOD_MASK_SHIFT, KC_DOT, KC_COLN);
+
+const key_override_t *key_overrides[] = {
+    &delete_key_override,
+    &semicolon_key_override,
+    &colon_key_override,
+};
+// clang-format on
+
+void leader_end_user(void) {
+    if (leader_sequence_one_key(KC_E)) {
+        SEND_STRING("e@example.com");
+    } else if (leader_sequence_two_keys(KC_D, KC_D)) {
+        tap_code16(C(KC_A));
+        tap_code(KC_DEL);
+    } else if (leader_sequence_two_keys(KC_S, KC_S)) {
+        tap_code16(C(KC_S));
+    } else if (leader_sequence_three_keys(KC_G, KC_I, KC_T)) {
+        SEND_STRING("git ");
+    }
+}
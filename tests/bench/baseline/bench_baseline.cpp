@@ -0,0 +1,33 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "test_common.hpp"
+#include "bench.hpp"
+
+// clang-format off
+const uint16_t bench_keymap[][MATRIX_ROWS][MATRIX_COLS] = {
+    {
+        {KC_Q,    KC_W,    KC_E,    KC_R,    KC_T,   KC_Y,    KC_U,    KC_I,    KC_O,    KC_P},
+        {KC_A,    KC_S,    KC_D,    KC_F,    KC_G,   KC_H,    KC_J,    KC_K,    KC_L,    KC_SCLN},
+        {KC_Z,    KC_X,    KC_C,    KC_V,    KC_B,   KC_N,    KC_M,    KC_COMM, KC_DOT,  KC_SLSH},
+        {KC_LCTL, KC_LGUI, KC_LALT, KC_TAB,  KC_SPC, KC_ENT,  KC_BSPC, KC_MINS, KC_EQL,  KC_QUOT},
+    },
+};
+// clang-format on
+
+/* Plain keycodes with no features enabled, the floor for the other suites. */
+class Baseline : public BenchFixture {
+   protected:
+    Baseline() {
+        set_bench_keymap(bench_keymap);
+    }
+};
+
+TEST_F(Baseline, prose) {
+    run_bench("prose", type_text(BENCH_PROSE));
+}
+
+TEST_F(Baseline, fast_prose) {
+    run_bench("fast_prose", type_text(BENCH_PROSE, 40, 30));
+}
@@ -0,0 +1,47 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "test_common.hpp"
+#include "bench.hpp"
+
+// clang-format off
+const uint16_t bench_keymap[][MATRIX_ROWS][MATRIX_COLS] = {
+    {
+        {KC_Q,    KC_W,    KC_E,    KC_R,    KC_T,   KC_Y,    KC_U,    KC_I,    KC_O,    KC_P},
+        {KC_A,    KC_S,    KC_D,    KC_F,    KC_G,   KC_H,    KC_J,    KC_K,    KC_L,    KC_SCLN},
+        {KC_Z,    KC_X,    KC_C,    KC_V,    KC_B,   KC_N,    KC_M,    KC_COMM, KC_DOT,  KC_SLSH},
+        {KC_LCTL, KC_LGUI, KC_LALT, KC_TAB,  KC_SPC, KC_ENT,  KC_BSPC, KC_MINS, KC_EQL,  KC_QUOT},
+    },
+};
+// clang-format on
+
+/* Fourteen adjacent-key combos, every key press is held back until it can't be part of one. */
+class Combos : public BenchFixture {
+   protected:
+    Combos() {
+        set_bench_keymap(bench_keymap);
+    }
+};
+
+TEST_F(Combos, prose) {
+    run_bench("prose", type_text(BENCH_PROSE));
+}
+
+TEST_F(Combos, prose_with_chords) {
+    const std::vector<std::vector<uint16_t>> chords = {{KC_S, KC_D}, {KC_J, KC_K}, {KC_X, KC_C}, {KC_J, KC_K, KC_L}, {KC_COMM, KC_DOT}};
+    const std::string                        prose  = BENCH_PROSE;
+
+    std::vector<TraceEvent> events;
+    size_t                  word_start = 0, chord_index = 0;
+    while (word_start < prose.size()) {
+        size_t word_end = prose.find(' ', word_start);
+        if (word_end == std::string::npos) {
+            word_end = prose.size();
+        }
+        append(events, type_text(prose.substr(word_start, word_end - word_start + 1)));
+        append(events, chord(chords[chord_index++ % chords.size()]));
+        word_start = word_end + 1;
+    }
+    run_bench("prose_with_chords", events);
+}
@@ -0,0 +1,58 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "test_common.hpp"
+#include "bench.hpp"
+
+// clang-format off
+const uint16_t bench_keymap[][MATRIX_ROWS][MATRIX_COLS] = {
+    {
+        {KC_Q,    KC_W,    KC_E,    KC_R,    KC_T,   KC_Y,    KC_U,    KC_I,    KC_O,    KC_P},
+        {KC_A,    KC_S,    KC_D,    KC_F,    KC_G,   KC_H,    KC_J,    KC_K,    KC_L,    KC_SCLN},
+        {KC_Z,    KC_X,    KC_C,    KC_V,    KC_B,   KC_N,    KC_M,    KC_COMM, KC_DOT,  KC_SLSH},
+        {KC_LCTL, MO(1),   KC_LALT, KC_TAB,  KC_SPC, KC_ENT,  KC_BSPC, KC_MINS, KC_EQL,  KC_QUOT},
+    },
+    {
+        {KC_1,    KC_2,    KC_3,    KC_4,    KC_5,   KC_6,    KC_7,    KC_8,    KC_9,    KC_0},
+        {_______, _______, _______, _______, _______, _______, _______, _______, _______, _______},
+        {_______, _______, _______, _______, _______, _______, _______, _______, _______, _______},
+        {_______, _______, _______, _______, _______, _______, _______, _______, _______, _______},
+    },
+};
+// clang-format on
+
+/*
+ * Every press stores its source layer and every release reads it back, the
+ * packed_byte and packed_nibble suites run the same streams with
+ * SOURCE_LAYERS_CACHE_PACKED.
+ */
+class SourceLayersCache : public BenchFixture {
+   protected:
+    SourceLayersCache() {
+        set_bench_keymap(bench_keymap);
+    }
+};
+
+TEST_F(SourceLayersCache, prose) {
+    run_bench("prose", type_text(BENCH_PROSE));
+}
+
+/* A digit after every word, typed on layer 1 and released after MO(1), so the release comes from the cache. */
+TEST_F(SourceLayersCache, prose_with_layer_chords) {
+    const std::vector<uint16_t> digits = {KC_Q, KC_W, KC_E, KC_R, KC_T, KC_Y, KC_U, KC_I, KC_O, KC_P};
+    const std::string           prose  = BENCH_PROSE;
+
+    std::vector<TraceEvent> events;
+    size_t                  word_start = 0, digit_index = 0;
+    while (word_start < prose.size()) {
+        size_t word_end = prose.find(' ', word_start);
+        if (word_end == std::string::npos) {
+            word_end = prose.size();
+        }
+        append(events, type_text(prose.substr(word_start, word_end - word_start + 1)));
+        append(events, chord({MO(1), digits[digit_index++ % digits.size()]}));
+        word_start = word_end + 1;
+    }
+    run_bench("prose_with_layer_chords", events);
+}
@@ -0,0 +1,12 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TAPPING_TERM 200
+
+#define COMBO_LOOKUP_INDEX_SIZE 16
+// Fewer key ids than the 7 distinct combo keycodes, the keycode lookup is used without bitsets
+#define COMBO_KEY_IDS 4
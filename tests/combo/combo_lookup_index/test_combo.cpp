@@ -0,0 +1,123 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "keymap_introspection.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class ComboLookupIndex : public TestFixture {};
+
+TEST_F(ComboLookupIndex, index_fits_all_combos) {
+    EXPECT_TRUE(combo_lookup_index_build());
+}
+
+TEST_F(ComboLookupIndex, combo_tapped) {
+    TestDriver driver;
+    KeymapKey  key_z(0, 0, 0, KC_Z);
+    KeymapKey  key_x(0, 0, 1, KC_X);
+    set_keymap({key_z, key_x});
+
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_z, key_x});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboLookupIndex, combo_keys_sorted_differently_from_definition) {
+    TestDriver driver;
+    KeymapKey  key_q(0, 0, 0, KC_Q);
+    KeymapKey  key_w(0, 0, 1, KC_W);
+    set_keymap({key_q, key_w});
+
+    EXPECT_REPORT(driver, (KC_TAB));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_q, key_w});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboLookupIndex, longer_overlapping_combo_wins) {
+    TestDriver driver;
+    KeymapKey  key_y(0, 0, 0, KC_Y);
+    KeymapKey  key_u(0, 0, 1, KC_U);
+    KeymapKey  key_i(0, 0, 2, KC_I);
+    set_keymap({key_y, key_u, key_i});
+
+    EXPECT_REPORT(driver, (KC_ENTER));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_y, key_u, key_i});
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_SPACE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_y, key_u});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboLookupIndex, key_outside_combos_is_not_delayed) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboLookupIndex, partial_combo_is_replayed) {
+    TestDriver driver;
+    KeymapKey  key_z(0, 0, 0, KC_Z);
+    set_keymap({key_z});
+
+    EXPECT_REPORT(driver, (KC_Z));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_z);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboLookupIndex, membership_bitsets) {
+    ASSERT_TRUE(combo_lookup_index_build());
+    if (COMBO_KEY_IDS < 7) {
+        GTEST_SKIP() << "the combo keycodes don't fit in the key ids, no bitsets are built";
+    }
+
+    // Key ids follow keycode order: I, Q, U, W, X, Y, Z
+    EXPECT_EQ(combo_get(0)->members, 0b0100100);
+    EXPECT_EQ(combo_get(1)->members, 0b0100101);
+    EXPECT_EQ(combo_get(2)->members, 0b1010000);
+    EXPECT_EQ(combo_get(3)->members, 0b0001010);
+}
+
+TEST_F(ComboLookupIndex, partial_combo_state_is_cleared) {
+    TestDriver driver;
+    KeymapKey  key_y(0, 0, 0, KC_Y);
+    KeymapKey  key_u(0, 0, 1, KC_U);
+    set_keymap({key_y, key_u});
+
+    // Y alone is replayed, leaving no state behind in the combos containing it
+    EXPECT_REPORT(driver, (KC_Y));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_y, COMBO_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_U));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_u);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_SPACE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_u, key_y});
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,20 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+enum combos { yu, yui, zx, qw };
+
+uint16_t const yu_combo[]  = {KC_Y, KC_U, COMBO_END};
+uint16_t const yui_combo[] = {KC_Y, KC_U, KC_I, COMBO_END};
+uint16_t const zx_combo[]  = {KC_Z, KC_X, COMBO_END};
+uint16_t const qw_combo[]  = {KC_W, KC_Q, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [yu]  = COMBO(yu_combo, KC_SPACE),
+    [yui] = COMBO(yui_combo, KC_ENTER),
+    [zx]  = COMBO(zx_combo, KC_ESCAPE),
+    [qw]  = COMBO(qw_combo, KC_TAB),
+};
+// clang-format on
@@ -0,0 +1,22 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+const key_override_t delete_key_override    = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+const key_override_t ctrl_a_b_key_override  = ko_make_basic(MOD_MASK_CTRL, KC_A, KC_B);
+const key_override_t ctrl_a_c_key_override  = ko_make_basic(MOD_MASK_CTRL, KC_A, KC_C);
+const key_override_t semicolon_key_override = ko_make_basic(MOD_MASK_SHIFT, KC_COMM, KC_SCLN);
+const key_override_t ralt_f1_key_override   = ko_make_basic(MOD_BIT(KC_RALT), KC_NO, KC_F1);
+const key_override_t colon_key_override     = ko_make_basic(MOD_MASK_SHIFT, KC_DOT, KC_COLN);
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    &delete_key_override,
+    &ctrl_a_b_key_override,
+    &ctrl_a_c_key_override,
+    &semicolon_key_override,
+    &ralt_f1_key_override,
+    &colon_key_override,
+};
+// clang-format on
@@ -0,0 +1,12 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+uint16_t const yu_combo[] = {KC_Y, KC_U, COMBO_END};
+uint16_t const hj_combo[] = {KC_H, KC_J, COMBO_END};
+
+combo_t key_combos[] = {
+    COMBO(yu_combo, KC_SPACE),
+    COMBO(hj_combo, MO(1)),
+};
@@ -0,0 +1,145 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "profiling.h"
+}
+
+using testing::_;
+
+class LatencyTrace : public TestFixture {
+   public:
+    void SetUp() override {
+        TestFixture::SetUp();
+        profiling_reset();
+    }
+};
+
+static uint32_t path_count(uint8_t probe) {
+    profiling_stats_t stats;
+    EXPECT_TRUE(profiling_get_stats(probe, &stats));
+    return stats.count;
+}
+
+TEST_F(LatencyTrace, DirectKeyIsTracedUntilReport) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(path_count(PROFILING_PROBE_LATENCY_DIRECT), 2);
+    EXPECT_EQ(path_count(PROFILING_PROBE_LATENCY_TAPPING), 0);
+    EXPECT_EQ(path_count(PROFILING_PROBE_LATENCY_COMBO), 0);
+}
+
+TEST_F(LatencyTrace, KeyWithoutReportIsNotTraced) {
+    TestDriver driver;
+    auto       layer_key = KeymapKey(0, 0, 0, MO(1));
+    auto       key       = KeymapKey(0, 1, 0, KC_A);
+    set_keymap({layer_key, key});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(layer_key);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(path_count(PROFILING_PROBE_LATENCY_DIRECT), 0);
+
+    // The layer key edges must not linger and be closed by a later report
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(path_count(PROFILING_PROBE_LATENCY_DIRECT), 2);
+}
+
+TEST_F(LatencyTrace, TapHoldKeyIsTracedAsTapping) {
+    TestDriver driver;
+    auto       mod_tap = KeymapKey(0, 0, 0, LSFT_T(KC_P));
+    set_keymap({mod_tap});
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(mod_tap);
+    VERIFY_AND_CLEAR(driver);
+
+    // Both edges go out together once the tap is resolved
+    EXPECT_EQ(path_count(PROFILING_PROBE_LATENCY_TAPPING), 2);
+    EXPECT_EQ(path_count(PROFILING_PROBE_LATENCY_DIRECT), 0);
+}
+
+TEST_F(LatencyTrace, KeysInterruptingTapHoldAreTracedAsTapping) {
+    TestDriver driver;
+    auto       mod_tap = KeymapKey(0, 0, 0, LSFT_T(KC_P));
+    auto       key     = KeymapKey(0, 1, 0, KC_A);
+    set_keymap({mod_tap, key});
+
+    // The press of A waits in the waiting_buffer until the mod-tap resolves
+    EXPECT_NO_REPORT(driver);
+    mod_tap.press();
+    run_one_scan_loop();
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(path_count(PROFILING_PROBE_LATENCY_TAPPING), 2);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    mod_tap.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(path_count(PROFILING_PROBE_LATENCY_DIRECT), 2);
+}
+
+TEST_F(LatencyTrace, ComboKeysAreTracedAsCombo) {
+    TestDriver driver;
+    auto       key_y = KeymapKey(0, 0, 0, KC_Y);
+    auto       key_u = KeymapKey(0, 1, 0, KC_U);
+    set_keymap({key_y, key_u});
+
+    EXPECT_REPORT(driver, (KC_SPACE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_y, key_u});
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(path_count(PROFILING_PROBE_LATENCY_COMBO), 2);
+    EXPECT_EQ(path_count(PROFILING_PROBE_LATENCY_TAPPING), 0);
+
+    profiling_stats_t stats;
+    ASSERT_TRUE(profiling_get_stats(PROFILING_PROBE_LATENCY_COMBO, &stats));
+    EXPECT_LE(stats.min_ns, stats.p50_ns);
+    EXPECT_LE(stats.p99_ns, stats.max_ns);
+}
+
+TEST_F(LatencyTrace, ComboWithoutReportIsNotTraced) {
+    TestDriver driver;
+    auto       key_h = KeymapKey(0, 0, 0, KC_H);
+    auto       key_j = KeymapKey(0, 1, 0, KC_J);
+    auto       key   = KeymapKey(0, 2, 0, KC_A);
+    set_keymap({key_h, key_j, key});
+
+    EXPECT_NO_REPORT(driver);
+    tap_combo({key_h, key_j});
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(path_count(PROFILING_PROBE_LATENCY_COMBO), 0);
+
+    // The combo keys must not linger and be closed by a later report
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(path_count(PROFILING_PROBE_LATENCY_COMBO), 0);
+    EXPECT_EQ(path_count(PROFILING_PROBE_LATENCY_DIRECT), 2);
+}
@@ -0,0 +1,81 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "test_common.hpp"
+
+using testing::_;
+
+class LayerResolutionCache : public TestFixture {
+   public:
+    void set_keymap(std::initializer_list<KeymapKey> keys) {
+        TestFixture::set_keymap(keys);
+        // The test keymap lives outside of dynamic keymaps, so tell the cache it changed
+        layer_resolution_cache_invalidate();
+    }
+};
+
+TEST_F(LayerResolutionCache, ResolvesThroughDeepTransparentStack) {
+    TestDriver driver;
+    KeymapKey  base = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey  mid  = KeymapKey(4, 0, 0, KC_B);
+    set_keymap({base, mid});
+    for (uint8_t layer = 1; layer < 16; layer++) {
+        if (layer != 4) {
+            add_key(KeymapKey(layer, 0, 0, KC_TRNS));
+        }
+    }
+
+    keypos_t key = {.col = 0, .row = 0};
+    EXPECT_EQ(layer_switch_get_layer(key), 0);
+
+    layer_state_set(0xFFFE);
+    EXPECT_EQ(layer_switch_get_layer(key), 4);
+    // Cached answer stays the same
+    EXPECT_EQ(layer_switch_get_layer(key), 4);
+
+    layer_off(4);
+    EXPECT_EQ(layer_switch_get_layer(key), 0);
+
+    layer_on(4);
+    EXPECT_EQ(layer_switch_get_layer(key), 4);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(base);
+    VERIFY_AND_CLEAR(driver);
+
+    layer_clear();
+}
+
+TEST_F(LayerResolutionCache, EvictsLeastRecentlyUsedLayerState) {
+    KeymapKey key_0 = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey key_1 = KeymapKey(1, 0, 0, KC_B);
+    KeymapKey key_2 = KeymapKey(2, 0, 0, KC_C);
+    set_keymap({key_0, key_1, key_2});
+
+    keypos_t key = {.col = 0, .row = 0};
+    for (int round = 0; round < 3; round++) {
+        layer_move(0);
+        EXPECT_EQ(layer_switch_get_layer(key), 0);
+        layer_move(1);
+        EXPECT_EQ(layer_switch_get_layer(key), 1);
+        layer_move(2);
+        EXPECT_EQ(layer_switch_get_layer(key), 2);
+    }
+    layer_clear();
+}
+
+TEST_F(LayerResolutionCache, InvalidateAfterKeymapChange) {
+    KeymapKey base  = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey upper = KeymapKey(1, 0, 0, KC_TRNS);
+    set_keymap({base, upper});
+
+    keypos_t key = {.col = 0, .row = 0};
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key), 0);
+
+    set_keymap({base, KeymapKey(1, 0, 0, KC_B)});
+    EXPECT_EQ(layer_switch_get_layer(key), 1);
+    layer_clear();
+}
@@ -0,0 +1,159 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+using testing::_;
+using testing::Invoke;
+
+class MousekeySubpixel : public TestFixture {
+   protected:
+    /* Adds up the motion of every mouse report, and counts the reports. */
+    void record_motion(TestDriver& driver) {
+        EXPECT_CALL(driver, send_mouse_mock(_)).WillRepeatedly(Invoke([this](report_mouse_t& report) {
+            x += report.x;
+            y += report.y;
+            v += report.v;
+            reports++;
+            if (report.x == 0 && report.y == 0 && report.v == 0 && report.h == 0) {
+                empty_reports++;
+            }
+        }));
+    }
+
+    void reset_motion() {
+        x = y = v = reports = empty_reports = 0;
+    }
+
+    int x = 0, y = 0, v = 0, reports = 0, empty_reports = 0;
+};
+
+TEST_F(MousekeySubpixel, slow_motion_carries_fractions) {
+    TestDriver driver;
+    KeymapKey  key_right(0, 0, 0, QK_MOUSE_CURSOR_RIGHT);
+    KeymapKey  key_acl0(0, 1, 0, QK_MOUSE_ACCELERATION_0);
+    set_keymap({key_right, key_acl0});
+    record_motion(driver);
+
+    // A quarter of the max speed is one pixel per interval, a twentieth of a pixel per step
+    key_acl0.press();
+    run_one_scan_loop();
+    key_right.press();
+    run_one_scan_loop();
+    idle_for(MOUSEKEY_DELAY);
+    reset_motion();
+
+    idle_for(MOUSEKEY_INTERVAL * 20);
+    EXPECT_EQ(x, 20);
+    EXPECT_EQ(reports, 20);
+    EXPECT_EQ(y, 0);
+
+    key_right.release();
+    run_one_scan_loop();
+    key_acl0.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MousekeySubpixel, diagonal_motion_is_not_rounded_up) {
+    TestDriver driver;
+    KeymapKey  key_right(0, 0, 0, QK_MOUSE_CURSOR_RIGHT);
+    KeymapKey  key_down(0, 1, 0, QK_MOUSE_CURSOR_DOWN);
+    KeymapKey  key_acl2(0, 2, 0, QK_MOUSE_ACCELERATION_2);
+    set_keymap({key_right, key_down, key_acl2});
+    record_motion(driver);
+
+    key_acl2.press();
+    run_one_scan_loop();
+    key_right.press();
+    key_down.press();
+    run_one_scan_loop();
+    idle_for(MOUSEKEY_DELAY);
+    reset_motion();
+
+    // 4 / sqrt(2) pixels per interval on each axis
+    idle_for(MOUSEKEY_INTERVAL * 50);
+    EXPECT_NEAR(x, 141, 1);
+    EXPECT_NEAR(y, 141, 1);
+    EXPECT_EQ(empty_reports, 0);
+
+    key_right.release();
+    key_down.release();
+    run_one_scan_loop();
+    key_acl2.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MousekeySubpixel, accelerates_to_max_speed) {
+    TestDriver driver;
+    KeymapKey  key_left(0, 0, 0, QK_MOUSE_CURSOR_LEFT);
+    set_keymap({key_left});
+    record_motion(driver);
+
+    key_left.press();
+    run_one_scan_loop();
+    idle_for(MOUSEKEY_DELAY);
+
+    // Linear ramp from 1 to 4 pixels per interval, the first step after the
+    // delay already moved by one interval
+    reset_motion();
+    idle_for(MOUSEKEY_INTERVAL * MOUSEKEY_TIME_TO_MAX);
+    EXPECT_NEAR(x, -28, 1);
+
+    reset_motion();
+    idle_for(MOUSEKEY_INTERVAL * 10);
+    EXPECT_NEAR(x, -40, 1);
+
+    key_left.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MousekeySubpixel, high_rate_reports_only_whole_pixels) {
+    TestDriver driver;
+    KeymapKey  key_up(0, 0, 0, QK_MOUSE_CURSOR_UP);
+    set_keymap({key_up});
+    record_motion(driver);
+
+    key_up.press();
+    run_one_scan_loop();
+    idle_for(MOUSEKEY_DELAY + MOUSEKEY_INTERVAL * MOUSEKEY_TIME_TO_MAX);
+
+    // Stepping every millisecond still only reports when a pixel is complete
+    reset_motion();
+    idle_for(MOUSEKEY_INTERVAL * 10);
+    EXPECT_NEAR(y, -40, 1);
+    EXPECT_NEAR(reports, 40, 1);
+    EXPECT_EQ(empty_reports, 0);
+
+    key_up.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MousekeySubpixel, slow_wheel_carries_fractions) {
+    TestDriver driver;
+    KeymapKey  key_wheel_down(0, 0, 0, QK_MOUSE_WHEEL_DOWN);
+    KeymapKey  key_acl0(0, 1, 0, QK_MOUSE_ACCELERATION_0);
+    set_keymap({key_wheel_down, key_acl0});
+    record_motion(driver);
+
+    // A quarter of the max wheel speed, two steps per wheel interval
+    key_acl0.press();
+    run_one_scan_loop();
+    key_wheel_down.press();
+    run_one_scan_loop();
+    idle_for(MOUSEKEY_WHEEL_DELAY);
+    reset_motion();
+
+    idle_for(MOUSEKEY_WHEEL_INTERVAL * 10);
+    EXPECT_EQ(v, -20);
+    EXPECT_EQ(empty_reports, 0);
+
+    key_wheel_down.release();
+    run_one_scan_loop();
+    key_acl0.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
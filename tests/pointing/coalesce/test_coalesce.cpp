@@ -0,0 +1,119 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+using testing::InSequence;
+
+class PointingCoalesce : public TestFixture {
+   protected:
+    /* Moves by one count and idles until just after a report is due, so the
+     * next report is sent on the POINTING_DEVICE_REPORT_INTERVAL_MS-th scan. */
+    void sync_to_report(TestDriver& driver) {
+        int32_t reported_at = 0;
+        EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0)).WillOnce([&](report_mouse_t&) { reported_at = timer_read32(); });
+        pd_set_x(1);
+        run_one_scan_loop();
+        pd_clear_movement();
+        idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS);
+        VERIFY_AND_CLEAR(driver);
+
+        const int32_t interval = POINTING_DEVICE_REPORT_INTERVAL_MS;
+        idle_for(((reported_at + 1 - (int32_t)timer_read32()) % interval + interval) % interval);
+    }
+};
+
+TEST_F(PointingCoalesce, SendsOneReportPerInterval) {
+    TestDriver driver;
+    sync_to_report(driver);
+
+    pd_set_x(10);
+    pd_set_y(-5);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS - 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (40, -20, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    pd_clear_movement();
+    EXPECT_NO_MOUSE_REPORT(driver);
+    idle_for(2 * POINTING_DEVICE_REPORT_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingCoalesce, SplitsOverflowAcrossReports) {
+    TestDriver driver;
+    sync_to_report(driver);
+
+    {
+        InSequence s;
+        EXPECT_MOUSE_REPORT(driver, (127, -127, 0, 0, 0));
+        EXPECT_MOUSE_REPORT(driver, (127, -127, 0, 0, 0));
+        EXPECT_MOUSE_REPORT(driver, (127, -127, 0, 0, 0));
+        EXPECT_MOUSE_REPORT(driver, (19, -19, 0, 0, 0));
+    }
+    pd_set_x(100);
+    pd_set_y(-100);
+    idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS);
+    pd_clear_movement();
+    idle_for(4 * POINTING_DEVICE_REPORT_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingCoalesce, SplitsScrollAcrossReports) {
+    TestDriver driver;
+    sync_to_report(driver);
+
+    {
+        InSequence s;
+        EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 127, 0));
+        EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 33, 0));
+    }
+    pd_set_v(80);
+    idle_for(2);
+    pd_clear_movement();
+    idle_for(3 * POINTING_DEVICE_REPORT_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingCoalesce, ButtonsAreReportedWithTheNextReport) {
+    TestDriver driver;
+    sync_to_report(driver);
+
+    pd_press_button(POINTING_DEVICE_BUTTON1);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS - 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 1));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    pd_release_button(POINTING_DEVICE_BUTTON1);
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 0));
+    idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingCoalesce, StopsSoonAfterFastMotion) {
+    TestDriver driver;
+    sync_to_report(driver);
+
+    // Far more than one report can carry, for many intervals
+    EXPECT_MOUSE_REPORT(driver, (127, 0, 0, 0, 0)).Times(20);
+    pd_set_x(100);
+    idle_for(20 * POINTING_DEVICE_REPORT_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    // Only the capped backlog is left once the sensor stops
+    EXPECT_ANY_MOUSE_REPORT(driver).Times(testing::Between(1, POINTING_DEVICE_COALESCE_MAX));
+    pd_clear_movement();
+    idle_for(20 * POINTING_DEVICE_REPORT_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+}
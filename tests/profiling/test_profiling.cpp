@@ -0,0 +1,140 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "profiling.h"
+}
+
+using testing::_;
+
+class Profiling : public TestFixture {
+   public:
+    void SetUp() override {
+        TestFixture::SetUp();
+        profiling_reset();
+    }
+};
+
+static void expect_ordered_stats(uint8_t probe) {
+    profiling_stats_t stats;
+    ASSERT_TRUE(profiling_get_stats(probe, &stats));
+    EXPECT_LE(stats.min_ns, stats.p50_ns);
+    EXPECT_LE(stats.p50_ns, stats.p99_ns);
+    EXPECT_LE(stats.p99_ns, stats.max_ns);
+    EXPECT_LE(stats.min_ns, stats.mean_ns);
+    EXPECT_LE(stats.mean_ns, stats.max_ns);
+}
+
+TEST_F(Profiling, BuiltinProbesRecordHotPaths) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    profiling_stats_t stats;
+    ASSERT_TRUE(profiling_get_stats(PROFILING_PROBE_MATRIX_TASK, &stats));
+    EXPECT_STREQ(stats.name, "matrix_task");
+    EXPECT_GE(stats.count, 2);
+    expect_ordered_stats(PROFILING_PROBE_MATRIX_TASK);
+
+    // Only the press and release are timed, not the idle ticks
+    ASSERT_TRUE(profiling_get_stats(PROFILING_PROBE_ACTION_EXEC, &stats));
+    EXPECT_EQ(stats.count, 2);
+    expect_ordered_stats(PROFILING_PROBE_ACTION_EXEC);
+
+    ASSERT_TRUE(profiling_get_stats(PROFILING_PROBE_HOUSEKEEPING_TASK, &stats));
+    EXPECT_GE(stats.count, 2);
+
+    ASSERT_TRUE(profiling_get_stats(PROFILING_PROBE_SPLIT_TRANSACTIONS, &stats));
+    EXPECT_EQ(stats.count, 0);
+}
+
+TEST_F(Profiling, PercentilesFollowHistogram) {
+    uint8_t probe = profiling_probe_register("synthetic");
+    ASSERT_NE(probe, PROFILING_NO_PROBE);
+    EXPECT_EQ(profiling_probe_register("synthetic"), probe);
+
+    // 98 fast samples, 2 slow outliers
+    for (int i = 0; i < 98; i++) {
+        profiling_record_ticks(probe, 1000);
+    }
+    profiling_record_ticks(probe, 50000);
+    profiling_record_ticks(probe, 60000);
+
+    profiling_stats_t stats;
+    ASSERT_TRUE(profiling_get_stats(probe, &stats));
+    EXPECT_EQ(stats.count, 100);
+    EXPECT_EQ(stats.min_ns, 1000);
+    EXPECT_EQ(stats.max_ns, 60000);
+    EXPECT_EQ(stats.mean_ns, (98 * 1000 + 50000 + 60000) / 100);
+    // Four buckets per octave, so the estimate is within 25% above the sample
+    EXPECT_GE(stats.p50_ns, 1000);
+    EXPECT_LT(stats.p50_ns, 1250);
+    EXPECT_GE(stats.p99_ns, 50000);
+    EXPECT_LE(stats.p99_ns, 60000);
+    expect_ordered_stats(probe);
+}
+
+TEST_F(Profiling, ProbeTableIsBounded) {
+    // Registrations persist across tests, fill whatever room is left
+    static const char *names[] = {"user_1", "user_2", "user_3"};
+    for (const char *name : names) {
+        uint8_t probe = profiling_probe_register(name);
+        if (probe == PROFILING_NO_PROBE) {
+            break;
+        }
+        EXPECT_EQ(profiling_probe_register(name), probe);
+    }
+    EXPECT_EQ(profiling_probe_count(), PROFILING_MAX_PROBES);
+    EXPECT_EQ(profiling_probe_register("one_too_many"), PROFILING_NO_PROBE);
+
+    // Out of range probes are ignored
+    profiling_record_ticks(PROFILING_NO_PROBE, 10);
+    profiling_stats_t stats;
+    EXPECT_FALSE(profiling_get_stats(PROFILING_NO_PROBE, &stats));
+}
+
+TEST_F(Profiling, RawHidQuery) {
+    uint8_t probe = profiling_probe_register("synthetic");
+    profiling_record_ticks(probe, 300);
+    profiling_record_ticks(probe, 500);
+
+    uint8_t data[32] = {PROFILING_RAW_HID_ID, profiling_raw_hid_get_probe_stats, probe};
+    ASSERT_TRUE(profiling_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[1], profiling_raw_hid_get_probe_stats);
+    EXPECT_EQ(data[3], 2);    // count
+    EXPECT_EQ(data[7], 44);   // min, 300 = 0x12C
+    EXPECT_EQ(data[8], 1);
+    EXPECT_EQ(data[15], 144); // mean, 400 = 0x190
+    EXPECT_EQ(data[16], 1);
+
+    uint8_t name[32] = {PROFILING_RAW_HID_ID, profiling_raw_hid_get_probe_name, PROFILING_PROBE_ACTION_EXEC};
+    ASSERT_TRUE(profiling_raw_hid_receive(name, sizeof(name)));
+    EXPECT_STREQ((const char *)&name[3], "action_exec");
+
+    // Names are truncated to the report, short reports are rejected
+    uint8_t short_name[8] = {PROFILING_RAW_HID_ID, profiling_raw_hid_get_probe_name, PROFILING_PROBE_ACTION_EXEC, 0, 0, 0, 0, 0xAA};
+    ASSERT_TRUE(profiling_raw_hid_receive(short_name, 7));
+    EXPECT_STREQ((const char *)&short_name[3], "act");
+    EXPECT_EQ(short_name[7], 0xAA);
+    uint8_t too_short[4] = {PROFILING_RAW_HID_ID, profiling_raw_hid_get_probe_name, PROFILING_PROBE_ACTION_EXEC, 0xAA};
+    ASSERT_TRUE(profiling_raw_hid_receive(too_short, 3));
+    EXPECT_EQ(too_short[1], profiling_raw_hid_unhandled);
+    EXPECT_EQ(too_short[3], 0xAA);
+
+    uint8_t other[32] = {0x01, profiling_raw_hid_get_probe_count};
+    EXPECT_FALSE(profiling_raw_hid_receive(other, sizeof(other)));
+
+    uint8_t reset[32] = {PROFILING_RAW_HID_ID, profiling_raw_hid_reset};
+    ASSERT_TRUE(profiling_raw_hid_receive(reset, sizeof(reset)));
+    profiling_stats_t stats;
+    ASSERT_TRUE(profiling_get_stats(probe, &stats));
+    EXPECT_EQ(stats.count, 0);
+}
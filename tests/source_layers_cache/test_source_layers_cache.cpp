@@ -0,0 +1,43 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "test_common.hpp"
+
+using testing::_;
+
+class SourceLayersCache : public TestFixture {};
+
+TEST_F(SourceLayersCache, StoresLayerOfEveryKey) {
+    for (uint8_t round = 0; round < MAX_LAYER; round++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                update_source_layers_cache({.col = col, .row = row}, (round + row * MATRIX_COLS + col) % MAX_LAYER);
+            }
+        }
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                EXPECT_EQ(read_source_layers_cache({.col = col, .row = row}), (round + row * MATRIX_COLS + col) % MAX_LAYER);
+            }
+        }
+    }
+}
+
+TEST_F(SourceLayersCache, ReleaseUsesLayerOfPress) {
+    TestDriver driver;
+    KeymapKey  base  = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey  upper = KeymapKey(MAX_LAYER - 1, 0, 0, KC_B);
+    set_keymap({base, upper});
+
+    layer_on(MAX_LAYER - 1);
+    EXPECT_REPORT(driver, (KC_B));
+    upper.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    layer_off(MAX_LAYER - 1);
+    EXPECT_EMPTY_REPORT(driver);
+    upper.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
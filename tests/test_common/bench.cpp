@@ -0,0 +1,220 @@
+/* Copyright 2024 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "bench.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "host.h"
+#include "keycodes.h"
+#include "quantum_keycodes.h"
+}
+
+const char* const BENCH_PROSE =
+    "the quick brown fox jumps over the lazy dog. a keyboard firmware spends most of its time "
+    "waiting for the next key, but every key that does arrive has to pass through a long chain "
+    "of features before it reaches the host, and each of them takes its share of the scan. "
+    "typing at a steady pace, with the odd comma, full stop and apostrophe, isn't fast enough "
+    "to notice any of it, yet the same chain runs on every press and every release, all day long.";
+
+namespace {
+
+struct BenchResult {
+    std::string name;
+    size_t      events;
+    unsigned    samples;
+    double      ns_per_event;
+    double      min_ns_per_event;
+};
+
+std::vector<BenchResult> results;
+
+uint8_t null_keyboard_leds(void) {
+    return 0;
+}
+void null_send_keyboard(report_keyboard_t* report) {}
+void null_send_nkro(report_nkro_t* report) {}
+void null_send_mouse(report_mouse_t* report) {}
+void null_send_extra(report_extra_t* report) {}
+
+host_driver_t null_driver = {null_keyboard_leds, null_send_keyboard, null_send_nkro, null_send_mouse, null_send_extra};
+
+uint16_t tap_keycode(uint16_t keycode) {
+    if (IS_QK_MOD_TAP(keycode)) {
+        return QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+    }
+    if (IS_QK_LAYER_TAP(keycode)) {
+        return QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+    }
+    return keycode;
+}
+
+uint16_t char_keycode(char c) {
+    if (c >= 'a' && c <= 'z') {
+        return KC_A + (c - 'a');
+    }
+    if (c >= '1' && c <= '9') {
+        return KC_1 + (c - '1');
+    }
+    switch (c) {
+        case '0':
+            return KC_0;
+        case ' ':
+            return KC_SPACE;
+        case '\n':
+            return KC_ENTER;
+        case '.':
+            return KC_DOT;
+        case ',':
+            return KC_COMMA;
+        case ';':
+            return KC_SEMICOLON;
+        case '/':
+            return KC_SLASH;
+        case '\'':
+            return KC_QUOTE;
+        case '-':
+            return KC_MINUS;
+        default:
+            return KC_NO;
+    }
+}
+
+/* Writes the results as JSON, with a fixed layout so that CI can diff and parse it. */
+class BenchReport : public testing::Environment {
+   public:
+    void TearDown() override {
+        const char* path = std::getenv("BENCH_OUTPUT");
+        if (path == nullptr) {
+            write(std::cout);
+            return;
+        }
+        std::ofstream file(path);
+        write(file);
+    }
+
+   private:
+    static void write(std::ostream& os) {
+        os << "{\n";
+        os << "  \"suite\": \"" << BENCH_SUITE << "\",\n";
+        os << "  \"unit\": \"ns/event\",\n";
+        os << "  \"benchmarks\": [";
+        for (size_t i = 0; i < results.size(); i++) {
+            const BenchResult& result = results[i];
+            os << (i ? ",\n" : "\n") << std::fixed << std::setprecision(1);
+            os << "    {\"name\": \"" << result.name << "\", \"events\": " << result.events << ", \"samples\": " << result.samples << ", \"ns_per_event\": " << result.ns_per_event << ", \"min_ns_per_event\": " << result.min_ns_per_event << "}";
+        }
+        os << (results.empty() ? "]\n" : "\n  ]\n");
+        os << "}\n";
+    }
+};
+
+testing::Environment* const bench_report = testing::AddGlobalTestEnvironment(new BenchReport);
+
+} // namespace
+
+void BenchFixture::get_keycode(const layer_t layer, const keypos_t position, uint16_t* result) const {
+    if (m_keymap == nullptr) {
+        TestFixture::get_keycode(layer, position, result);
+        return;
+    }
+    *result = layer < m_layers ? m_keymap[layer][position.row][position.col] : KC_NO;
+}
+
+keypos_t BenchFixture::find_position(uint16_t keycode) const {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (tap_keycode(m_keymap[0][row][col]) == keycode) {
+                return {.col = col, .row = row};
+            }
+        }
+    }
+    ADD_FAILURE() << "keycode " << keycode << " is not on layer 0 of the bench keymap";
+    return {.col = 0, .row = 0};
+}
+
+std::vector<TraceEvent> BenchFixture::type_keys(const std::vector<uint16_t>& keycodes, unsigned interval_ms, unsigned hold_ms) const {
+    std::vector<TraceEvent> events;
+    uint32_t                time = 0;
+
+    for (uint16_t keycode : keycodes) {
+        const keypos_t key = find_position(keycode);
+        events.push_back({time, key.row, key.col, true});
+        events.push_back({time + hold_ms, key.row, key.col, false});
+        time += interval_ms;
+    }
+    std::stable_sort(events.begin(), events.end(), [](const TraceEvent& a, const TraceEvent& b) { return a.time < b.time; });
+    return events;
+}
+
+std::vector<TraceEvent> BenchFixture::type_text(const std::string& text, unsigned interval_ms, unsigned hold_ms) const {
+    std::vector<uint16_t> keycodes;
+    for (char c : text) {
+        keycodes.push_back(char_keycode(c));
+    }
+    return type_keys(keycodes, interval_ms, hold_ms);
+}
+
+std::vector<TraceEvent> BenchFixture::chord(const std::vector<uint16_t>& keycodes, unsigned hold_ms) const {
+    std::vector<TraceEvent> events;
+    uint32_t                time = 0;
+
+    for (uint16_t keycode : keycodes) {
+        const keypos_t key = find_position(keycode);
+        events.push_back({time, key.row, key.col, true});
+        time += 5;
+    }
+    for (size_t i = 0, presses = events.size(); i < presses; i++) {
+        events.push_back({events[i].time + hold_ms, events[i].row, events[i].col, false});
+    }
+    return events;
+}
+
+void BenchFixture::append(std::vector<TraceEvent>& events, const std::vector<TraceEvent>& more, unsigned gap_ms) {
+    const uint32_t start = events.empty() ? 0 : events.back().time + gap_ms;
+    for (TraceEvent event : more) {
+        event.time += start;
+        events.push_back(event);
+    }
+}
+
+void BenchFixture::run_bench(const std::string& name, const std::vector<TraceEvent>& events, unsigned samples) {
+    host_driver_t* saved_driver = host_get_driver();
+    host_set_driver(&null_driver);
+
+    std::vector<double> means;
+    for (unsigned sample = 0; sample <= samples; sample++) {
+        TraceReplay replay;
+        replay.replay(events);
+
+        const auto& costs = replay.event_cost_ns();
+        const auto  total = std::accumulate(costs.begin(), costs.end(), uint64_t{0});
+        if (sample > 0 && !costs.empty()) {
+            means.push_back(static_cast<double>(total) / costs.size());
+        }
+    }
+    host_set_driver(saved_driver);
+
+    ASSERT_FALSE(means.empty()) << name << " has no events";
+    std::sort(means.begin(), means.end());
+    results.push_back({name, events.size(), samples, means[means.size() / 2], means.front()});
+}
@@ -0,0 +1,82 @@
+/* Copyright 2024 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "test_fixture.hpp"
+#include "trace_replay.hpp"
+
+/**
+ * @brief A paragraph of lowercase English prose, for `type_text`.
+ */
+extern const char* const BENCH_PROSE;
+
+/**
+ * @brief Fixture for the `make bench:<suite>` microbenchmarks.
+ *
+ * Keycodes are looked up in a plain [layer][row][col] array like a firmware
+ * keymap, and reports go to a host driver that drops them, so the test harness
+ * adds as little as possible to the measured cost. Every `run_bench` result is
+ * written to the suite's JSON report when the benchmark program exits.
+ */
+class BenchFixture : public TestFixture {
+   public:
+    template <size_t Layers>
+    void set_bench_keymap(const uint16_t (&keymap)[Layers][MATRIX_ROWS][MATRIX_COLS]) {
+        m_keymap = keymap;
+        m_layers = Layers;
+    }
+
+    void get_keycode(const layer_t layer, const keypos_t position, uint16_t* result) const override;
+
+    /**
+     * @brief Taps `keycodes` on layer 0 of the bench keymap, one key every
+     * `interval_ms`, each held for `hold_ms`. Dual-role keys are found by
+     * their tap keycode.
+     */
+    std::vector<TraceEvent> type_keys(const std::vector<uint16_t>& keycodes, unsigned interval_ms = 90, unsigned hold_ms = 70) const;
+
+    /**
+     * @brief Types lowercase `text`, see `type_keys`.
+     */
+    std::vector<TraceEvent> type_text(const std::string& text, unsigned interval_ms = 90, unsigned hold_ms = 70) const;
+
+    /**
+     * @brief Presses `keycodes` together, 5ms apart, and releases them after `hold_ms`.
+     */
+    std::vector<TraceEvent> chord(const std::vector<uint16_t>& keycodes, unsigned hold_ms = 60) const;
+
+    /**
+     * @brief Appends `more` to `events`, starting `gap_ms` after the last event.
+     */
+    static void append(std::vector<TraceEvent>& events, const std::vector<TraceEvent>& more, unsigned gap_ms = 90);
+
+    /**
+     * @brief Replays `events` through keyboard_task() `samples` times, after
+     * one warm-up run, and records the median and the fastest mean cost per
+     * event as benchmark `name`.
+     */
+    void run_bench(const std::string& name, const std::vector<TraceEvent>& events, unsigned samples = 7);
+
+   private:
+    keypos_t find_position(uint16_t keycode) const;
+
+    const uint16_t (*m_keymap)[MATRIX_ROWS][MATRIX_COLS] = nullptr;
+    size_t m_layers                                      = 0;
+};
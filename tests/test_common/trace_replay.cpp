@@ -0,0 +1,133 @@
+/* Copyright 2024 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "trace_replay.hpp"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include "keyboard_report_util.hpp"
+
+extern "C" {
+#include "keyboard.h"
+#include "matrix_trace.h"
+#include "test_matrix.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+using testing::Invoke;
+
+std::vector<TraceEvent> parse_trace(std::istream& input) {
+    std::vector<TraceEvent> events;
+    std::string             line;
+
+    while (std::getline(input, line)) {
+        auto tag = line.find(MATRIX_TRACE_TAG);
+        if (tag == std::string::npos) {
+            continue;
+        }
+
+        std::istringstream fields(line.substr(tag + sizeof(MATRIX_TRACE_TAG) - 1));
+        uint32_t           time;
+        unsigned           row, col, pressed;
+        if (fields >> time >> row >> col >> pressed) {
+            events.push_back({time, static_cast<uint8_t>(row), static_cast<uint8_t>(col), pressed != 0});
+        }
+    }
+    return events;
+}
+
+std::vector<TraceEvent> load_trace(const std::string& path) {
+    std::ifstream file(path);
+    return parse_trace(file);
+}
+
+TraceReplay::TraceReplay(TestDriver& driver) {
+    EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([this](report_keyboard_t& report) { m_reports.push_back({timer_read32() + m_time_offset, report}); }));
+}
+
+void TraceReplay::replay(const std::vector<TraceEvent>& events, unsigned settle_ms) {
+    if (!events.empty()) {
+        m_time_offset = events.front().time - timer_read32();
+    }
+
+    size_t next = 0;
+    while (next < events.size()) {
+        while (static_cast<int32_t>(events[next].time - (timer_read32() + m_time_offset)) > 0) {
+            scan(0);
+        }
+
+        // Apply every event that is due in this scan, unless a key changes twice
+        std::vector<keypos_t> changed;
+        for (; next < events.size() && static_cast<int32_t>(events[next].time - (timer_read32() + m_time_offset)) <= 0; next++) {
+            const TraceEvent& event = events[next];
+            if (std::any_of(changed.begin(), changed.end(), [&](keypos_t key) { return key.row == event.row && key.col == event.col; })) {
+                break;
+            }
+            changed.push_back({.col = event.col, .row = event.row});
+
+            if (event.pressed) {
+                press_key(event.col, event.row);
+            } else {
+                release_key(event.col, event.row);
+            }
+        }
+        scan(changed.size());
+    }
+
+    for (unsigned i = 0; i < settle_ms; i++) {
+        scan(0);
+    }
+}
+
+void TraceReplay::scan(size_t events) {
+    const auto start = std::chrono::steady_clock::now();
+    keyboard_task();
+    const uint64_t cost = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    for (size_t i = 0; i < events; i++) {
+        m_event_cost_ns.push_back(cost / events);
+    }
+
+    housekeeping_task();
+    advance_time(1);
+}
+
+void TraceReplay::write_reports(std::ostream& os) const {
+    for (const auto& report : m_reports) {
+        os << report.time << " " << report.report;
+    }
+}
+
+void TraceReplay::write_cost_summary(std::ostream& os) const {
+    if (m_event_cost_ns.empty()) {
+        os << "events: 0" << std::endl;
+        return;
+    }
+
+    std::vector<uint64_t> sorted = m_event_cost_ns;
+    std::sort(sorted.begin(), sorted.end());
+
+    uint64_t total = 0;
+    for (auto cost : sorted) {
+        total += cost;
+    }
+
+    os << "events: " << sorted.size() << ", reports: " << m_reports.size() << ", cost per event (ns) mean: " << total / sorted.size() << " p50: " << sorted[(sorted.size() - 1) * 50 / 100] << " p99: " << sorted[(sorted.size() - 1) * 99 / 100] << " max: " << sorted.back() << std::endl;
+}
@@ -0,0 +1,100 @@
+/* Copyright 2024 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "report.h"
+#include "test_driver.hpp"
+
+/**
+ * @brief A single matrix edge, as captured with MATRIX_TRACE_ENABLE.
+ */
+struct TraceEvent {
+    uint32_t time;
+    uint8_t  row;
+    uint8_t  col;
+    bool     pressed;
+};
+
+/**
+ * @brief Extracts the `matrix_trace:` lines out of console output, any other
+ * output (debug prints, `qmk console` prefixes, comments) is skipped.
+ */
+std::vector<TraceEvent> parse_trace(std::istream& input);
+
+/**
+ * @brief Reads a trace file, see `parse_trace`. Returns no events if the file
+ * can't be opened.
+ */
+std::vector<TraceEvent> load_trace(const std::string& path);
+
+/**
+ * @brief Replays a matrix trace through the full keyboard_task() pipeline.
+ *
+ * The trace is replayed at one scan per millisecond of trace time on the
+ * simulated test timer, so timing dependent features (tapping term, combo
+ * term, ...) behave exactly as they did on the keyboard, while a session of
+ * tens of thousands of keystrokes still replays in seconds. Keyboard reports
+ * are recorded with the trace time they were sent at, and the host time spent
+ * in each scan that saw a matrix change is attributed to its events.
+ *
+ * All positions in the trace have to be mapped in the keymap of the running
+ * TestFixture.
+ */
+class TraceReplay {
+   public:
+    struct Report {
+        uint32_t          time;
+        report_keyboard_t report;
+    };
+
+    /** @brief Replays without recording reports, whichever host driver is set gets them. */
+    TraceReplay() = default;
+    explicit TraceReplay(TestDriver& driver);
+
+    /**
+     * @brief Replays `events`, then keeps scanning for `settle_ms` so that
+     * pending tap-hold decisions and timeouts resolve.
+     */
+    void replay(const std::vector<TraceEvent>& events, unsigned settle_ms = 1000);
+
+    const std::vector<Report>& reports() const {
+        return m_reports;
+    }
+
+    /** @brief Host processing cost of each replayed event, in nanoseconds. */
+    const std::vector<uint64_t>& event_cost_ns() const {
+        return m_event_cost_ns;
+    }
+
+    /** @brief Writes one `<time> report: (...) [...]` line per keyboard report. */
+    void write_reports(std::ostream& os) const;
+
+    /** @brief Writes the event count and the mean, p50, p99 and max event cost. */
+    void write_cost_summary(std::ostream& os) const;
+
+   private:
+    void scan(size_t events);
+
+    std::vector<Report>   m_reports;
+    std::vector<uint64_t> m_event_cost_ns;
+    uint32_t              m_time_offset = 0;
+};
@@ -0,0 +1,162 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "keycode.h"
+#include "test_common.hpp"
+#include "trace_replay.hpp"
+
+extern "C" {
+#include "debug.h"
+}
+
+using testing::_;
+
+namespace {
+
+std::string trace_path(const std::string& name) {
+    std::string file = __FILE__;
+    return file.substr(0, file.find_last_of('/') + 1) + name;
+}
+
+std::string read_file(const std::string& path) {
+    std::ifstream     file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+// clang-format off
+const uint16_t base_layer[MATRIX_ROWS][MATRIX_COLS] = {
+    {KC_Q,    KC_W,    KC_E,    KC_R,         KC_T,   KC_Y,           KC_U,    KC_I,    KC_O,    KC_P},
+    {KC_A,    KC_S,    KC_D,    KC_F,         KC_G,   KC_H,           KC_J,    KC_K,    KC_L,    KC_SCLN},
+    {KC_Z,    KC_X,    KC_C,    KC_V,         KC_B,   KC_N,           KC_M,    KC_COMM, KC_DOT,  KC_SLSH},
+    {KC_LCTL, KC_LGUI, KC_LALT, LT(1, KC_TAB), KC_SPC, SFT_T(KC_ENT), KC_BSPC, KC_MINS, KC_EQL,  KC_QUOT},
+};
+const uint16_t number_row[MATRIX_COLS] = {KC_1, KC_2, KC_3, KC_4, KC_5, KC_6, KC_7, KC_8, KC_9, KC_0};
+// clang-format on
+
+} // namespace
+
+class TraceReplayTest : public TestFixture {
+   protected:
+    void set_test_layout() {
+        keymap.clear();
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                add_key(KeymapKey(0, col, row, base_layer[row][col]));
+                add_key(KeymapKey(1, col, row, row == 0 ? number_row[col] : KC_TRANSPARENT));
+            }
+        }
+    }
+};
+
+TEST_F(TraceReplayTest, parses_console_capture) {
+    std::istringstream capture(
+        "# comment\n"
+        "test_keyboard:default:1: matrix_trace: 1000 3 5 1\n"
+        "some other debug output\n"
+        "matrix_trace: 1020 0 9 0\n"
+        "matrix_trace: truncated\n");
+
+    auto events = parse_trace(capture);
+
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events[0].time, 1000);
+    EXPECT_EQ(events[0].row, 3);
+    EXPECT_EQ(events[0].col, 5);
+    EXPECT_TRUE(events[0].pressed);
+    EXPECT_EQ(events[1].time, 1020);
+    EXPECT_EQ(events[1].row, 0);
+    EXPECT_EQ(events[1].col, 9);
+    EXPECT_FALSE(events[1].pressed);
+}
+
+TEST_F(TraceReplayTest, replay_matches_recorded_reports) {
+    TestDriver driver;
+    set_test_layout();
+
+    auto events = load_trace(trace_path("typing.trace"));
+    ASSERT_EQ(events.size(), 20);
+
+    TraceReplay replay(driver);
+    replay.replay(events);
+
+    std::stringstream reports;
+    replay.write_reports(reports);
+    EXPECT_EQ(reports.str(), read_file(trace_path("typing.reports")));
+    EXPECT_EQ(replay.event_cost_ns().size(), events.size());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TraceReplayTest, captured_session_replays_identically) {
+    TestDriver driver;
+    set_test_layout();
+    auto mod_tap_key = KeymapKey(0, 5, 3, SFT_T(KC_ENT));
+    auto key_h       = KeymapKey(0, 5, 1, KC_H);
+    auto key_i       = KeymapKey(0, 7, 0, KC_I);
+
+    /* Type a session live, capturing the console and the reports. */
+    TraceReplay live(driver);
+    testing::internal::CaptureStdout();
+    mod_tap_key.press();
+    idle_for(20);
+    tap_key(key_h, 30);
+    idle_for(TAPPING_TERM);
+    mod_tap_key.release();
+    idle_for(50);
+    tap_key(key_i, 30);
+    idle_for(TAPPING_TERM);
+    auto capture = std::istringstream(testing::internal::GetCapturedStdout());
+    VERIFY_AND_CLEAR(driver);
+
+    auto events = parse_trace(capture);
+    ASSERT_EQ(events.size(), 6);
+
+    /* Replaying the capture reproduces the reports at the same trace time. */
+    TraceReplay replayed(driver);
+    replayed.replay(events);
+    VERIFY_AND_CLEAR(driver);
+
+    std::stringstream live_reports, replayed_reports;
+    live.write_reports(live_reports);
+    replayed.write_reports(replayed_reports);
+    EXPECT_FALSE(live.reports().empty());
+    EXPECT_EQ(replayed_reports.str(), live_reports.str());
+}
+
+/* Replays TRACE_REPLAY_FILE on the test layout, e.g. to benchmark a recorded
+ * session against config changes:
+ *
+ *   TRACE_REPLAY_FILE=session.txt TRACE_REPLAY_OUTPUT=reports.txt make test:trace_replay
+ */
+TEST_F(TraceReplayTest, replay_file_from_environment) {
+    const char* path = std::getenv("TRACE_REPLAY_FILE");
+    if (path == nullptr) {
+        GTEST_SKIP() << "TRACE_REPLAY_FILE is not set";
+    }
+
+    TestDriver driver;
+    set_test_layout();
+
+    auto events = load_trace(path);
+    ASSERT_FALSE(events.empty()) << "no matrix_trace events in " << path;
+
+    // Keep console output out of the measured cost
+    const debug_config_t saved_debug_config = debug_config;
+    debug_config.raw                         = 0;
+
+    TraceReplay replay(driver);
+    replay.replay(events);
+    replay.write_cost_summary(std::cout);
+    debug_config = saved_debug_config;
+
+    if (const char* output = std::getenv("TRACE_REPLAY_OUTPUT")) {
+        std::ofstream file(output);
+        replay.write_reports(file);
+    }
+    VERIFY_AND_CLEAR(driver);
+}